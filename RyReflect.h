@@ -5,13 +5,26 @@
  * @github https://github.com/ZZray/RyReflect.git
  */
 #pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <expected>
+#include <initializer_list>
+#include <limits>
 #include <map>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <tuple>
 #include <utility>
 #include <variant>
 #include <vector>
-#include <iostream>
 #include <concepts>
+#include "RyReflectForEach.h"
  // 检查是否定义了RY_USE_QT宏来决定是否使用Qt
 #ifdef RY_USE_QT
 #include <QJsonObject>
@@ -20,6 +33,20 @@
 #include <QString>
 #include <QJsonDocument>
 #endif
+// 字符串转义使用的SIMD指令集，定义 RY_DISABLE_SIMD 可以强制使用标量实现
+#ifndef RY_DISABLE_SIMD
+#if defined(__AVX2__)
+#define RYREFLECT_HAS_AVX2
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RYREFLECT_HAS_SSE2
+#endif
+#endif
+#if defined(RYREFLECT_HAS_AVX2)
+#include <immintrin.h>
+#elif defined(RYREFLECT_HAS_SSE2)
+#include <emmintrin.h>
+#endif
 
 namespace RyReflect
 {
@@ -35,6 +62,50 @@ namespace RyReflect
     struct is_container<T, std::void_t<decltype(std::declval<T>().begin()), decltype(std::declval<T>().end()), typename T::value_type>> : std::true_type
     { };
 
+    // 有 begin/end 但按JSON字符串而不是数组编解码的类型，与 writeJson 的类型分派一致
+    template <typename T>
+    inline constexpr bool is_string_like_v = std::is_same_v<T, std::string>
+#ifdef RY_USE_QT
+                                             || std::is_same_v<T, QString> || std::is_same_v<T, QByteArray>
+#endif
+        ;
+
+    // 元素可以通过迭代器原地改写、并能在末尾追加和截断的序列容器（如 std::vector、std::deque、std::list），
+    // 原地反序列化时复用其中已有的元素及其内部缓冲区。std::vector<bool> 的元素不可单独寻址，std::set 的元素不可修改，均不在此列
+    template <typename T>
+    concept ReusableContainer = is_container<T>::value && std::default_initializable<typename T::value_type> && requires(T& c, typename T::iterator it) {
+        { *it } -> std::same_as<typename T::value_type&>;
+        { c.emplace(c.end()) } -> std::same_as<typename T::iterator>;
+        c.erase(it, c.end());
+    };
+
+    // 把复用的元素恢复为默认构造的值，避免上一次解码的内容残留在这次输入缺失或为 null 的成员中。
+    // 从默认值复制赋值时 std::string、std::vector 等成员保留已有的容量
+    template <typename T>
+    void resetReusedElement(T& value)
+    {
+        if constexpr (std::is_copy_assignable_v<T>) {
+            static const T defaults{};
+            value = defaults;
+        }
+        else {
+            value = T{};
+        }
+    }
+
+    // 返回 it 指向的元素用于原地写入并前移 it；已有的元素先恢复为默认值，it 已到末尾时追加一个默认构造的元素
+    template <ReusableContainer Container>
+    typename Container::value_type& reuseContainerElement(Container& container, typename Container::iterator& it)
+    {
+        if (it == container.end()) {
+            it = container.emplace(container.end());
+        }
+        else {
+            resetReusedElement(*it);
+        }
+        return *it++;
+    }
+
     // 判断类型 T 是否可以使用 forEach
     template <typename T>
     concept ForEachable = requires(T t) {
@@ -53,8 +124,9 @@ namespace RyReflect
     void forEachImpl(T&& obj, F&& f, std::index_sequence<I...>)
     {
         using U = std::remove_reference_t<T>;
-        auto names = U::getMemberNames();
-        auto values = obj.getMemberValues();
+        // 没有成员的类型不会用到 names 和 values
+        [[maybe_unused]] auto names  = U::getMemberNames();
+        [[maybe_unused]] auto values = obj.getMemberValues();
         // 通过参数包展开，依次调用传入的函数f
         (f(std::get<I>(names), std::get<I>(values)), ...);
     }
@@ -68,780 +140,305 @@ namespace RyReflect
         forEachImpl(std::forward<T>(obj), std::forward<F>(f), std::make_index_sequence<N>{});
     }
 
+    // 反射类型的成员数量
+    template <typename T>
+    inline constexpr std::size_t memberCount = std::tuple_size_v<decltype(std::remove_cvref_t<T>::getMemberNames())>;
+
+    // 编译期把 getMemberNames() 转换为 std::string_view 数组
+    template <typename T>
+    constexpr auto memberNameArray()
+    {
+        constexpr auto names = std::remove_cvref_t<T>::getMemberNames();
+        return std::apply([](auto... name) { return std::array<std::string_view, sizeof...(name)>{std::string_view(name)...}; }, names);
+    }
+
+    // 参与哈希的字符位置，offset 超出键长度时取最后一个字符
+    struct MemberKeyPosition
+    {
+        std::uint16_t offset  = 0;
+        bool          fromEnd = false;
+
+        constexpr unsigned char at(std::string_view key) const
+        {
+            const std::size_t index = offset < key.size() ? offset : key.size() - 1;
+            return static_cast<unsigned char>(fromEnd ? key[key.size() - 1 - index] : key[index]);
+        }
+    };
+
+    // 编译期生成的成员名完美哈希表（hash and displace）：
+    // 键先按长度和少数几个能区分所有成员名的字符位置哈希到桶，每个桶有一个编译期搜索出的位移种子，
+    // 使得所有成员名落在互不冲突的槽位上。查找时只计算两次哈希并做一次 memcmp
+    template <std::size_t N>
+    struct MemberHashTable
+    {
+        static constexpr std::size_t maxPositions = 8;
+        static constexpr std::size_t bucketCount  = N / 2 + 1;
+        static constexpr std::size_t slotCount    = std::bit_ceil(N * 2 + 1);
+        static constexpr std::uint16_t emptySlot  = 0xFFFF;
+
+        std::array<std::string_view, N>                 names{};
+        std::array<MemberKeyPosition, maxPositions>     positions{};
+        std::size_t                                     positionCount = 0;
+        std::array<std::uint16_t, bucketCount>          displacements{};
+        std::array<std::uint16_t, slotCount>            slots{};
+
+        constexpr std::uint32_t hash(std::string_view key, std::uint32_t seed) const
+        {
+            std::uint32_t h = ((seed + 1) * 0x9E3779B9u ^ static_cast<std::uint32_t>(key.size())) * 0x01000193u;
+            if (!key.empty()) {
+                for (std::size_t i = 0; i < positionCount; ++i) {
+                    h = (h ^ positions[i].at(key)) * 0x01000193u;
+                }
+            }
+            h ^= h >> 16;
+            h *= 0x85EBCA6Bu;
+            h ^= h >> 13;
+            return h;
+        }
+
+        // 返回成员下标，找不到时返回 N
+        constexpr std::size_t find(std::string_view key) const
+        {
+            if constexpr (N == 0) {
+                return 0;
+            }
+            else {
+                const auto displacement = displacements[hash(key, 0) % bucketCount];
+                const auto index        = slots[hash(key, displacement) & (slotCount - 1)];
+                return index != emptySlot && names[index] == key ? index : N;
+            }
+        }
+    };
+
+    template <std::size_t N>
+    constexpr MemberHashTable<N> buildMemberHashTable(const std::array<std::string_view, N>& names)
+    {
+        using Table = MemberHashTable<N>;
+        constexpr auto slotMask = Table::slotCount - 1;
+        Table table;
+        table.names = names;
+        std::size_t maxLength = 0;
+        for (const auto& name : names) {
+            maxLength = name.size() > maxLength ? name.size() : maxLength;
+        }
+        // 贪心地选取字符位置，直到长度加上这些位置的字符可以区分所有成员名；
+        // 只需要关注当前仍然冲突的成员名对，一般选两三个位置后就没有冲突了
+        std::array<std::pair<std::uint16_t, std::uint16_t>, N * (N - 1) / 2 + 1> pairs{};
+        std::size_t pairCount = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+            for (std::size_t j = i + 1; j < N; ++j) {
+                if (names[i].size() == names[j].size()) {
+                    pairs[pairCount++] = {static_cast<std::uint16_t>(i), static_cast<std::uint16_t>(j)};
+                }
+            }
+        }
+        while (pairCount != 0 && table.positionCount < Table::maxPositions) {
+            MemberKeyPosition best;
+            auto bestCollisions = pairCount;
+            for (std::size_t offset = 0; offset < maxLength; ++offset) {
+                for (const bool fromEnd : {false, true}) {
+                    const MemberKeyPosition candidate{static_cast<std::uint16_t>(offset), fromEnd};
+                    std::size_t current = 0;
+                    for (std::size_t p = 0; p < pairCount && current < bestCollisions; ++p) {
+                        current += candidate.at(names[pairs[p].first]) == candidate.at(names[pairs[p].second]) ? 1 : 0;
+                    }
+                    if (current < bestCollisions) {
+                        bestCollisions = current;
+                        best           = candidate;
+                    }
+                }
+            }
+            if (bestCollisions == pairCount) {
+                break;
+            }
+            table.positions[table.positionCount++] = best;
+            std::size_t remaining                  = 0;
+            for (std::size_t p = 0; p < pairCount; ++p) {
+                if (best.at(names[pairs[p].first]) == best.at(names[pairs[p].second])) {
+                    pairs[remaining++] = pairs[p];
+                }
+            }
+            pairCount = remaining;
+        }
+        if (pairCount != 0) {
+            throw "RyReflect: member names cannot be distinguished by the key hash";
+        }
+
+        // 按桶分组，再按桶大小从大到小为每个桶搜索位移种子
+        std::array<std::size_t, Table::bucketCount> bucketSizes{};
+        std::array<std::size_t, N> bucketOf{};
+        for (std::size_t i = 0; i < N; ++i) {
+            bucketOf[i] = table.hash(names[i], 0) % Table::bucketCount;
+            ++bucketSizes[bucketOf[i]];
+        }
+        table.slots.fill(Table::emptySlot);
+        for (std::size_t size = N; size > 0; --size) {
+            for (std::size_t bucket = 0; bucket < Table::bucketCount; ++bucket) {
+                if (bucketSizes[bucket] != size) {
+                    continue;
+                }
+                std::array<std::size_t, N> members{};
+                std::size_t count = 0;
+                for (std::size_t i = 0; i < N; ++i) {
+                    if (bucketOf[i] == bucket) {
+                        members[count++] = i;
+                    }
+                }
+                bool placed = false;
+                for (std::uint32_t seed = 1; seed < Table::emptySlot && !placed; ++seed) {
+                    std::array<std::size_t, N> slots{};
+                    placed = true;
+                    for (std::size_t k = 0; k < count && placed; ++k) {
+                        slots[k] = table.hash(names[members[k]], seed) & slotMask;
+                        placed   = table.slots[slots[k]] == Table::emptySlot;
+                        for (std::size_t m = 0; m < k && placed; ++m) {
+                            placed = slots[m] != slots[k];
+                        }
+                    }
+                    if (placed) {
+                        table.displacements[bucket] = static_cast<std::uint16_t>(seed);
+                        for (std::size_t k = 0; k < count; ++k) {
+                            table.slots[slots[k]] = static_cast<std::uint16_t>(members[k]);
+                        }
+                    }
+                }
+                if (!placed) {
+                    throw "RyReflect: failed to build the member hash table";
+                }
+            }
+        }
+        return table;
+    }
+
+    template <typename T>
+    inline constexpr auto memberHashTable = buildMemberHashTable(memberNameArray<T>());
+
+    // 根据键名查找成员下标，O(1)，找不到时返回 memberCount<T>
+    template <typename T>
+    constexpr std::size_t findMemberIndex(std::string_view key)
+    {
+        return memberHashTable<std::remove_cvref_t<T>>.find(key);
+    }
+
+    // 可以作为模板参数的编译期字符串，用于按名称访问成员，如 get<"name">()
+    template <std::size_t N>
+    struct FixedString
+    {
+        char data[N]{};
+
+        constexpr FixedString(const char (&str)[N])
+        {
+            for (std::size_t i = 0; i < N; ++i) {
+                data[i] = str[i];
+            }
+        }
+
+        constexpr std::string_view view() const { return std::string_view(data, N - 1); }
+    };
+
+    // 编译期按名称取成员下标，名称不存在时编译失败
+    template <typename T, FixedString Name>
+    consteval std::size_t memberIndex()
+    {
+        constexpr std::size_t index = findMemberIndex<T>(Name.view());
+        static_assert(index < memberCount<T>, "No member with this name");
+        return index;
+    }
+
+    // 第 I 个成员的类型
+    template <typename T, std::size_t I>
+    using MemberType = std::remove_cvref_t<std::tuple_element_t<I, decltype(std::declval<std::remove_cvref_t<T>&>().getMemberValues())>>;
+
+    // 第 I 个成员的成员指针，由 RY_REFLECTABLE 生成的 getMemberPointers() 提供
+    template <typename T, std::size_t I>
+    inline constexpr auto memberPointer = std::get<I>(std::remove_cvref_t<T>::getMemberPointers());
+
+    // 成员值的大类，与 toJsonValue 的类型分派对应
+    enum class FieldKind : std::uint8_t
+    {
+        Bool,
+        Integer,
+        Float,
+        String,
+        Object,
+        Array,
+    };
+
+    template <typename M>
+    constexpr FieldKind fieldKind()
+    {
+        if constexpr (std::is_same_v<M, bool>) {
+            return FieldKind::Bool;
+        }
+        else if constexpr (std::is_integral_v<M>) {
+            return FieldKind::Integer;
+        }
+        else if constexpr (std::is_floating_point_v<M>) {
+            return FieldKind::Float;
+        }
+        else if constexpr (std::is_same_v<M, std::string>) {
+            return FieldKind::String;
+        }
+#ifdef RY_USE_QT
+        else if constexpr (std::is_same_v<M, QString> || std::is_same_v<M, QByteArray>) {
+            return FieldKind::String;
+        }
+#endif
+        else if constexpr (ForEachable<M>) {
+            return FieldKind::Object;
+        }
+        else {
+            return FieldKind::Array;
+        }
+    }
+
+    // 类型擦除的成员描述，同一类型的所有成员放在一个 constexpr 数组中，可以用普通循环按下标遍历，
+    // 不需要为每个成员实例化 lambda。address 返回成员在 object 中的地址，由调用方根据 kind 转换为具体类型
+    struct FieldDescriptor
+    {
+        std::string_view name;
+        std::size_t      index;
+        FieldKind        kind;
+        bool             isSigned; // 有符号整数或浮点数
+        std::size_t      size;     // sizeof(成员类型)
+        void* (*address)(void* object);
+        const void* (*constAddress)(const void* object);
+    };
+
+    template <typename T, std::size_t... I>
+    constexpr auto makeFieldDescriptors(std::index_sequence<I...>)
+    {
+        constexpr auto names = memberNameArray<T>();
+        return std::array<FieldDescriptor, sizeof...(I)>{FieldDescriptor{ names[I],
+                                                                          I,
+                                                                          fieldKind<MemberType<T, I>>(),
+                                                                          std::is_signed_v<MemberType<T, I>>,
+                                                                          sizeof(MemberType<T, I>),
+                                                                          +[](void* object) -> void* { return &(static_cast<T*>(object)->*memberPointer<T, I>); },
+                                                                          +[](const void* object) -> const void* { return &(static_cast<const T*>(object)->*memberPointer<T, I>); } }...};
+    }
+
+    // 类型 T 的成员描述表，fieldDescriptors<T>[findMemberIndex<T>(key)] 可以在运行时按名称查找
+    template <typename T>
+    inline constexpr auto fieldDescriptors = makeFieldDescriptors<std::remove_cvref_t<T>>(std::make_index_sequence<memberCount<T>>{});
+
+    // 按描述访问成员，M 必须与成员的实际类型一致
+    template <typename M, typename T>
+    M& fieldValue(T& obj, const FieldDescriptor& field)
+    {
+        return *static_cast<M*>(field.address(&obj));
+    }
+
+    template <typename M, typename T>
+    const M& fieldValue(const T& obj, const FieldDescriptor& field)
+    {
+        return *static_cast<const M*>(field.constAddress(&obj));
+    }
+
     // 定义辅助宏，将变量名转换为字符串
 #define RYREFLECT_STRINGIZE(x) #x
-// 展开宏参数，解决宏递归展开问题
-#define RYREFLECT_EXPAND(x) x
-
-#define RYREFLECT_FOR_EACH_1(action, x)         action(x)
-#define RYREFLECT_FOR_EACH_2(action, x, x1)     action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1))
-#define RYREFLECT_FOR_EACH_3(action, x, x1, x2) action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2))
-#define RYREFLECT_FOR_EACH_4(action, x, x1, x2, x3)                                                                                                                                                    \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3))
-#define RYREFLECT_FOR_EACH_5(action, x, x1, x2, x3, x4)                                                                                                                                                \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4))
-#define RYREFLECT_FOR_EACH_6(action, x, x1, x2, x3, x4, x5)                                                                                                                                            \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5))
-#define RYREFLECT_FOR_EACH_7(action, x, x1, x2, x3, x4, x5, x6)                                                                                                                                        \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6))
-#define RYREFLECT_FOR_EACH_8(action, x, x1, x2, x3, x4, x5, x6, x7)                                                                                                                                    \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7))
-#define RYREFLECT_FOR_EACH_9(action, x, x1, x2, x3, x4, x5, x6, x7, x8)                                                                                                                                \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8))
-#define RYREFLECT_FOR_EACH_10(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9)                                                                                                                           \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9))
-#define RYREFLECT_FOR_EACH_11(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10)                                                                                                                      \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10))
-#define RYREFLECT_FOR_EACH_12(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11)                                                                                                                 \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11))
-#define RYREFLECT_FOR_EACH_13(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12)                                                                                                            \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12))
-#define RYREFLECT_FOR_EACH_14(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13)                                                                                                       \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13))
-#define RYREFLECT_FOR_EACH_15(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14)                                                                                                  \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14))
-#define RYREFLECT_FOR_EACH_16(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15)                                                                                             \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15))
-#define RYREFLECT_FOR_EACH_17(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16)                                                                                        \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16))
-#define RYREFLECT_FOR_EACH_18(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17)                                                                                   \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17))
-#define RYREFLECT_FOR_EACH_19(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18)                                                                              \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18))
-#define RYREFLECT_FOR_EACH_20(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19)                                                                         \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19))
-#define RYREFLECT_FOR_EACH_21(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20)                                                                    \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20))
-#define RYREFLECT_FOR_EACH_22(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21)                                                               \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21))
-#define RYREFLECT_FOR_EACH_23(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22)                                                          \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22))
-#define RYREFLECT_FOR_EACH_24(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23)                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23))
-#define RYREFLECT_FOR_EACH_25(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24)                                                \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24))
-#define RYREFLECT_FOR_EACH_26(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25)                                           \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25))
-#define RYREFLECT_FOR_EACH_27(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26)                                      \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26))
-#define RYREFLECT_FOR_EACH_28(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27)                                 \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27))
-#define RYREFLECT_FOR_EACH_29(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28)                            \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28))
-#define RYREFLECT_FOR_EACH_30(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29)                       \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29))
-#define RYREFLECT_FOR_EACH_31(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30)                  \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30))
-#define RYREFLECT_FOR_EACH_32(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31)             \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31))
-#define RYREFLECT_FOR_EACH_33(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32)        \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32))
-#define RYREFLECT_FOR_EACH_34(action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33)   \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33))
-#define RYREFLECT_FOR_EACH_35(                                                                                                                                                                         \
-    action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34)                        \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34))
-#define RYREFLECT_FOR_EACH_36(                                                                                                                                                                         \
-    action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35)                   \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35))
-#define RYREFLECT_FOR_EACH_37(                                                                                                                                                                         \
-    action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36)              \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36))
-#define RYREFLECT_FOR_EACH_38(                                                                                                                                                                         \
-    action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37)         \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37))
-#define RYREFLECT_FOR_EACH_39(                                                                                                                                                                         \
-    action, x, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, x32, x33, x34, x35, x36, x37, x38)    \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38))
-#define RYREFLECT_FOR_EACH_40(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39))
-#define RYREFLECT_FOR_EACH_41(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40))
-#define RYREFLECT_FOR_EACH_42(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41))
-#define RYREFLECT_FOR_EACH_43(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42))
-#define RYREFLECT_FOR_EACH_44(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43))
-#define RYREFLECT_FOR_EACH_45(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44))
-#define RYREFLECT_FOR_EACH_46(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45))
-#define RYREFLECT_FOR_EACH_47(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46))
-#define RYREFLECT_FOR_EACH_48(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46,   x47)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x47))
-#define RYREFLECT_FOR_EACH_49(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46,   x47,   x48)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x47)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x48))
-#define RYREFLECT_FOR_EACH_50(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46,   x47,   x48,   x49)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x47)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x48)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x49))
-#define RYREFLECT_FOR_EACH_51(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46,   x47,   x48,   x49,   x50)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x47)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x48)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x49)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x50))
-#define RYREFLECT_FOR_EACH_52(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46,   x47,   x48,   x49,   x50,   x51)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x47)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x48)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x49)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x50)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x51))
-#define RYREFLECT_FOR_EACH_53(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46,   x47,   x48,   x49,   x50,   x51,   x52)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x47)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x48)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x49)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x50)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x51)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x52))
-#define RYREFLECT_FOR_EACH_54(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46,   x47,   x48,   x49,   x50,   x51,   x52,   x53)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x47)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x48)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x49)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x50)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x51)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x52)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x53))
-#define RYREFLECT_FOR_EACH_55(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46,   x47,   x48,   x49,   x50,   x51,   x52,   x53,   x54)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x47)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x48)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x49)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x50)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x51)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x52)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x53)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x54))
-#define RYREFLECT_FOR_EACH_56(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46,   x47,   x48,   x49,   x50,   x51,   x52,   x53,   x54,   x55)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x47)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x48)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x49)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x50)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x51)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x52)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x53)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x54)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x55))
-#define RYREFLECT_FOR_EACH_57(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46,   x47,   x48,   x49,   x50,   x51,   x52,   x53,   x54,   x55,   x56)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x47)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x48)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x49)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x50)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x51)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x52)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x53)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x54)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x55)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x56))
-#define RYREFLECT_FOR_EACH_58(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46,   x47,   x48,   x49,   x50,   x51,   x52,   x53,   x54,   x55,   x56,   x57)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x47)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x48)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x49)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x50)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x51)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x52)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x53)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x54)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x55)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x56)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x57))
-#define RYREFLECT_FOR_EACH_59(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46,   x47,   x48,   x49,   x50,   x51,   x52,   x53,   x54,   x55,   x56,   x57,   x58)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x47)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x48)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x49)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x50)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x51)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x52)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x53)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x54)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x55)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x56)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x57)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x58))
-#define RYREFLECT_FOR_EACH_60(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46,   x47,   x48,   x49,   x50,   x51,   x52,   x53,   x54,   x55,   x56,   x57,   x58,   x59)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x47)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x48)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x49)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x50)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x51)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x52)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x53)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x54)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x55)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x56)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x57)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x58)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x59))
-#define RYREFLECT_FOR_EACH_61(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46,   x47,   x48,   x49,   x50,   x51,   x52,   x53,   x54,   x55,   x56,   x57,   x58,   x59,   x60)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x47)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x48)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x49)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x50)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x51)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x52)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x53)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x54)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x55)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x56)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x57)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x58)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x59)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x60))
-#define RYREFLECT_FOR_EACH_62(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46,   x47,   x48,   x49,   x50,   x51,   x52,   x53,   x54,   x55,   x56,   x57,   x58,   x59,   x60,   x61)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x47)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x48)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x49)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x50)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x51)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x52)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x53)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x54)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x55)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x56)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x57)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x58)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x59)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x60)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x61))
-#define RYREFLECT_FOR_EACH_63(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46,   x47,   x48,   x49,   x50,   x51,   x52,   x53,   x54,   x55,   x56,   x57,   x58,   x59,   x60,   x61,   x62)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x47)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x48)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x49)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x50)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x51)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x52)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x53)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x54)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x55)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x56)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x57)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x58)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x59)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x60)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x61)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x62))
-#define RYREFLECT_FOR_EACH_64(action,x,  x1,    x2,    x3,    x4,    x5,    x6,    x7,    x8,    x9,    x10,   x11,   x12,   x13,   x14,   x15,   x16,   x17,   x18,   x19,   x20,   x21,   x22,   x23,   x24,   x25,   x26,   x27,   x28,   x29,   x30,   x31,   x32,   x33,   x34,   x35,   x36,   x37,   x38,   x39,   x40,   x41,   x42,   x43,   x44,   x45,   x46,   x47,   x48,   x49,   x50,   x51,   x52,   x53,   x54,   x55,   x56,   x57,   x58,   x59,   x60,   x61,   x62,   x63)                                                                                                                                                                     \
-    action(x), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x1)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x2)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x3)),                             \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x4)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x5)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x6)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x7)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x8)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x9)),                                    \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x10)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x11)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x12)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x13)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x14)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x15)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x16)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x17)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x18)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x19)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x20)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x21)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x22)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x23)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x24)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x25)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x26)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x27)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x28)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x29)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x30)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x31)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x32)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x33)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x34)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x35)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x36)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x37)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x38)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x39)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x40)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x41)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x42)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x43)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x44)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x45)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x46)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x47)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x48)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x49)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x50)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x51)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x52)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x53)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x54)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x55)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x56)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x57)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x58)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x59)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x60)),                                 \
-        RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x61)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x62)), RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x63))
-
-// 获取可变参数的数量，选择对应的RYREFLECT_FOR_EACH_N宏
-#define RYREFLECT_GET_MACRO(_1, _2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,_17,_18,_19,_20,_21,_22,_23,_24,_25,_26,_27,_28,_29,_30,_31,_32,_33,_34,_35,_36,_37,_38,_39,_40,_41,_42,_43,_44,_45,_46,_47,_48,_49,_50,_51,_52,_53,_54,_55,_56,_57,_58,_59,_60,_61,_62,_63,_64,NAME,                                                                                                                                                                      \
-                            ...)                                                                                                                                                                       \
-    NAME
-
-// 定义RYREFLECT_FOR_EACH宏，根据参数数量调用对应的宏
-#define RYREFLECT_FOR_EACH(action, ...)                                                                                                                                                                \
-    RYREFLECT_EXPAND(RYREFLECT_GET_MACRO(__VA_ARGS__,          RYREFLECT_FOR_EACH_64,RYREFLECT_FOR_EACH_63,RYREFLECT_FOR_EACH_62,RYREFLECT_FOR_EACH_61,RYREFLECT_FOR_EACH_60,RYREFLECT_FOR_EACH_59,RYREFLECT_FOR_EACH_58,RYREFLECT_FOR_EACH_57,RYREFLECT_FOR_EACH_56,RYREFLECT_FOR_EACH_55,RYREFLECT_FOR_EACH_54,RYREFLECT_FOR_EACH_53,RYREFLECT_FOR_EACH_52,RYREFLECT_FOR_EACH_51,RYREFLECT_FOR_EACH_50,RYREFLECT_FOR_EACH_49,RYREFLECT_FOR_EACH_48,RYREFLECT_FOR_EACH_47,RYREFLECT_FOR_EACH_46,RYREFLECT_FOR_EACH_45,RYREFLECT_FOR_EACH_44,RYREFLECT_FOR_EACH_43,RYREFLECT_FOR_EACH_42,RYREFLECT_FOR_EACH_41,RYREFLECT_FOR_EACH_40,RYREFLECT_FOR_EACH_39,RYREFLECT_FOR_EACH_38,RYREFLECT_FOR_EACH_37,RYREFLECT_FOR_EACH_36,RYREFLECT_FOR_EACH_35,RYREFLECT_FOR_EACH_34,RYREFLECT_FOR_EACH_33,RYREFLECT_FOR_EACH_32,RYREFLECT_FOR_EACH_31,RYREFLECT_FOR_EACH_30,RYREFLECT_FOR_EACH_29,RYREFLECT_FOR_EACH_28,RYREFLECT_FOR_EACH_27,RYREFLECT_FOR_EACH_26,RYREFLECT_FOR_EACH_25,RYREFLECT_FOR_EACH_24,RYREFLECT_FOR_EACH_23,RYREFLECT_FOR_EACH_22,RYREFLECT_FOR_EACH_21,RYREFLECT_FOR_EACH_20,RYREFLECT_FOR_EACH_19,RYREFLECT_FOR_EACH_18,RYREFLECT_FOR_EACH_17,RYREFLECT_FOR_EACH_16,RYREFLECT_FOR_EACH_15,RYREFLECT_FOR_EACH_14,RYREFLECT_FOR_EACH_13,RYREFLECT_FOR_EACH_12,RYREFLECT_FOR_EACH_11,RYREFLECT_FOR_EACH_10,RYREFLECT_FOR_EACH_9, RYREFLECT_FOR_EACH_8, RYREFLECT_FOR_EACH_7, RYREFLECT_FOR_EACH_6, RYREFLECT_FOR_EACH_5, RYREFLECT_FOR_EACH_4, RYREFLECT_FOR_EACH_3, RYREFLECT_FOR_EACH_2, RYREFLECT_FOR_EACH_1)(action, __VA_ARGS__))
+// 取成员指针，RyReflectSelf 由 RY_REFLECTABLE 定义为所在的类型
+#define RYREFLECT_MEMBER_POINTER(x) &RyReflectSelf::x
 
 // 定义一个通用的JSON值类型
 #ifdef RY_USE_QT
@@ -850,12 +447,198 @@ namespace RyReflect
     using JsonArray = QJsonArray;
 #else
 // 如果不使用Qt，这里可以定义自己的JSON类型或使用其他库
+    struct JsonValue;
+
+    // 扁平的JSON对象：成员按插入顺序连续存放，并行保存每个键的哈希用于快速排除不匹配的键。
+    // 成员较少时（反射对象的常见情况）查找只线性扫描一个 uint32 数组；成员超过 linearLimit 时
+    // 额外建立开放寻址的索引表，避免解析大对象时退化为平方复杂度。
+    // 插入和删除会使迭代器失效，与 std::vector 相同
+    class JsonObject
+    {
+    public:
+        using value_type     = std::pair<std::string, JsonValue>;
+        using iterator       = std::vector<value_type>::iterator;
+        using const_iterator = std::vector<value_type>::const_iterator;
+
+        static constexpr std::size_t linearLimit = 32;
+
+        std::size_t size() const { return m_entries.size(); }
+        bool empty() const { return m_entries.empty(); }
+        iterator begin() { return m_entries.begin(); }
+        iterator end() { return m_entries.end(); }
+        const_iterator begin() const { return m_entries.begin(); }
+        const_iterator end() const { return m_entries.end(); }
+
+        void reserve(std::size_t count);
+        void clear();
+
+        iterator find(std::string_view key);
+        const_iterator find(std::string_view key) const;
+        bool contains(std::string_view key) const;
+
+        // 返回成员的副本，不存在时返回 null，与 QJsonObject::value 一致
+        JsonValue value(std::string_view key) const;
+
+        // 不存在时插入 null 成员
+        JsonValue& operator[](std::string_view key);
+
+        // 插入成员，键已存在时替换其值，与 QJsonObject::insert 一致
+        iterator insert(std::string key, JsonValue value);
+
+        std::size_t erase(std::string_view key);
+
+    private:
+        static constexpr std::uint32_t hashKey(std::string_view key)
+        {
+            std::uint32_t hash = 2166136261u;
+            for (const char ch : key) {
+                hash = (hash ^ static_cast<unsigned char>(ch)) * 16777619u;
+            }
+            return hash;
+        }
+
+        std::size_t indexOf(std::string_view key, std::uint32_t hash) const;
+        iterator append(std::string key, std::uint32_t hash, JsonValue value);
+        void insertIntoTable(std::size_t index);
+        void rebuildTable();
+
+        std::vector<value_type>    m_entries;
+        std::vector<std::uint32_t> m_hashes;
+        // 开放寻址索引表，槽位保存成员下标 + 1，0 表示空槽；成员不超过 linearLimit 时为空
+        std::vector<std::uint32_t> m_table;
+    };
+
     struct JsonValue
     {
-        std::variant<std::nullptr_t, bool, int, double, std::string, std::vector<JsonValue>, std::map<std::string, JsonValue>> value;
+        using Variant = std::variant<std::nullptr_t, bool, int, std::int64_t, std::uint64_t, double, std::string, std::vector<JsonValue>, JsonObject>;
+        Variant value;
+
+        JsonValue() = default;
+        // 允许从各个可选类型隐式构造，与 QJsonValue 的用法保持一致
+        template <typename V>
+            requires(!std::same_as<std::remove_cvref_t<V>, JsonValue> && std::constructible_from<Variant, V &&>)
+        JsonValue(V&& v)
+            : value(std::forward<V>(v))
+        { }
     };
-    using JsonObject = std::map<std::string, JsonValue>;
     using JsonArray = std::vector<JsonValue>;
+
+    inline void JsonObject::reserve(std::size_t count)
+    {
+        m_entries.reserve(count);
+        m_hashes.reserve(count);
+    }
+
+    inline void JsonObject::clear()
+    {
+        m_entries.clear();
+        m_hashes.clear();
+        m_table.clear();
+    }
+
+    inline std::size_t JsonObject::indexOf(std::string_view key, std::uint32_t hash) const
+    {
+        if (m_table.empty()) {
+            for (std::size_t i = 0; i < m_hashes.size(); ++i) {
+                if (m_hashes[i] == hash && m_entries[i].first == key) {
+                    return i;
+                }
+            }
+            return m_entries.size();
+        }
+        const std::size_t mask = m_table.size() - 1;
+        for (std::size_t slot = hash & mask; m_table[slot] != 0; slot = (slot + 1) & mask) {
+            const std::size_t i = m_table[slot] - 1;
+            if (m_hashes[i] == hash && m_entries[i].first == key) {
+                return i;
+            }
+        }
+        return m_entries.size();
+    }
+
+    inline JsonObject::iterator JsonObject::find(std::string_view key) { return m_entries.begin() + static_cast<std::ptrdiff_t>(indexOf(key, hashKey(key))); }
+
+    inline JsonObject::const_iterator JsonObject::find(std::string_view key) const { return m_entries.begin() + static_cast<std::ptrdiff_t>(indexOf(key, hashKey(key))); }
+
+    inline bool JsonObject::contains(std::string_view key) const { return indexOf(key, hashKey(key)) != m_entries.size(); }
+
+    inline JsonValue JsonObject::value(std::string_view key) const
+    {
+        const auto it = find(key);
+        return it == end() ? JsonValue(nullptr) : it->second;
+    }
+
+    inline JsonValue& JsonObject::operator[](std::string_view key)
+    {
+        const std::uint32_t hash = hashKey(key);
+        const std::size_t index  = indexOf(key, hash);
+        if (index != m_entries.size()) {
+            return m_entries[index].second;
+        }
+        return append(std::string(key), hash, JsonValue(nullptr))->second;
+    }
+
+    inline JsonObject::iterator JsonObject::insert(std::string key, JsonValue value)
+    {
+        const std::uint32_t hash = hashKey(key);
+        const std::size_t index  = indexOf(key, hash);
+        if (index != m_entries.size()) {
+            m_entries[index].second = std::move(value);
+            return m_entries.begin() + static_cast<std::ptrdiff_t>(index);
+        }
+        return append(std::move(key), hash, std::move(value));
+    }
+
+    inline std::size_t JsonObject::erase(std::string_view key)
+    {
+        const std::size_t index = indexOf(key, hashKey(key));
+        if (index == m_entries.size()) {
+            return 0;
+        }
+        m_entries.erase(m_entries.begin() + static_cast<std::ptrdiff_t>(index));
+        m_hashes.erase(m_hashes.begin() + static_cast<std::ptrdiff_t>(index));
+        rebuildTable();
+        return 1;
+    }
+
+    inline JsonObject::iterator JsonObject::append(std::string key, std::uint32_t hash, JsonValue value)
+    {
+        m_entries.emplace_back(std::move(key), std::move(value));
+        m_hashes.push_back(hash);
+        if (m_entries.size() > linearLimit) {
+            // 装载因子保持在 1/2 以下
+            if (m_entries.size() * 2 > m_table.size()) {
+                rebuildTable();
+            }
+            else {
+                insertIntoTable(m_entries.size() - 1);
+            }
+        }
+        return m_entries.end() - 1;
+    }
+
+    inline void JsonObject::insertIntoTable(std::size_t index)
+    {
+        const std::size_t mask = m_table.size() - 1;
+        std::size_t slot       = m_hashes[index] & mask;
+        while (m_table[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        m_table[slot] = static_cast<std::uint32_t>(index + 1);
+    }
+
+    inline void JsonObject::rebuildTable()
+    {
+        m_table.clear();
+        if (m_entries.size() <= linearLimit) {
+            m_table.shrink_to_fit();
+            return;
+        }
+        m_table.resize(std::bit_ceil(m_entries.size() * 4));
+        for (std::size_t i = 0; i < m_entries.size(); ++i) {
+            insertIntoTable(i);
+        }
+    }
 #endif
 
     // 前置声明
@@ -865,6 +648,110 @@ namespace RyReflect
     template <typename Container>
     JsonArray toJsonArray(const Container& container);
 
+    // 浮点数 value 是否为整数且能被整数类型 T 精确表示
+    template <typename T>
+    bool fitsInteger(double value)
+    {
+        // 2^digits 可以被 double 精确表示，用它作为开区间上界避免 max() 转换为 double 时向上取整
+        const double limit = std::ldexp(1.0, std::numeric_limits<T>::digits);
+        return std::trunc(value) == value && value < limit && value >= (std::is_signed_v<T> ? -limit : 0.0);
+    }
+
+    // 把任意算术类型转换为 JsonValue 能直接保存的数值：
+    // 能放进 int 的整数保存为 int，其余整数保存为 64 位整数，浮点数保存为 double
+    template <typename T>
+    JsonValue toJsonNumber(T value)
+    {
+        if constexpr (std::is_floating_point_v<T>) {
+            return JsonValue(static_cast<double>(value));
+        }
+        else if constexpr (std::in_range<int>(std::numeric_limits<T>::min()) && std::in_range<int>(std::numeric_limits<T>::max())) {
+            return JsonValue(static_cast<int>(value));
+        }
+#ifdef RY_USE_QT
+        else {
+            // QJsonValue 没有无符号64位整数，Qt 5 的 QJsonValue 更是把所有整数保存为 double。
+            // 无法精确保存的值抛出 std::out_of_range，而不是静默丢失精度；需要完整的 64 位范围时使用 toJsonString
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+            if (std::in_range<qint64>(value)) {
+                return QJsonValue(static_cast<qint64>(value));
+            }
+#else
+            constexpr std::int64_t exactLimit = std::int64_t{1} << std::numeric_limits<double>::digits;
+            if (std::in_range<qint64>(value) && static_cast<qint64>(value) <= exactLimit && static_cast<qint64>(value) >= -exactLimit) {
+                return QJsonValue(static_cast<qint64>(value));
+            }
+#endif
+            throw std::out_of_range("RyReflect: integer not exactly representable in QJsonValue");
+        }
+#else
+        else if constexpr (std::is_signed_v<T> || sizeof(T) < sizeof(std::uint64_t)) {
+            return JsonValue(static_cast<std::int64_t>(value));
+        }
+        else {
+            return JsonValue(static_cast<std::uint64_t>(value));
+        }
+#endif
+    }
+
+    // 把数值类型的 JsonValue 转换为算术类型 T，无法精确表示时抛出 std::out_of_range
+    template <typename T>
+    T fromJsonNumber(const JsonValue& jsonValue)
+    {
+#ifdef RY_USE_QT
+        if constexpr (std::is_floating_point_v<T>) {
+            return static_cast<T>(jsonValue.toDouble());
+        }
+        else {
+            if (!jsonValue.isDouble()) {
+                throw std::invalid_argument("RyReflect: JSON value is not a number");
+            }
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+            // Qt 6 的 QJsonValue 内部保留 64 位整数，toInteger() 只在值为整数时成功
+            const qint64 integer = jsonValue.toInteger(std::numeric_limits<qint64>::min());
+            if (integer != std::numeric_limits<qint64>::min() || jsonValue.toDouble() == static_cast<double>(integer)) {
+                if (std::in_range<T>(integer)) {
+                    return static_cast<T>(integer);
+                }
+            }
+            else if (fitsInteger<T>(jsonValue.toDouble())) {
+                return static_cast<T>(jsonValue.toDouble());
+            }
+#else
+            // Qt 5 的 QJsonValue 只保存 double
+            if (fitsInteger<T>(jsonValue.toDouble())) {
+                return static_cast<T>(jsonValue.toDouble());
+            }
+#endif
+            throw std::out_of_range("RyReflect: JSON number out of range");
+        }
+#else
+        return std::visit(
+            [](const auto& number) -> T {
+                using N = std::remove_cvref_t<decltype(number)>;
+                if constexpr (!std::is_arithmetic_v<N> || std::is_same_v<N, bool>) {
+                    throw std::bad_variant_access();
+                }
+                else if constexpr (std::is_floating_point_v<T>) {
+                    return static_cast<T>(number);
+                }
+                else if constexpr (std::is_floating_point_v<N>) {
+                    if (fitsInteger<T>(number)) {
+                        return static_cast<T>(number);
+                    }
+                    throw std::out_of_range("RyReflect: JSON number out of range");
+                }
+                else {
+                    if (std::in_range<T>(number)) {
+                        return static_cast<T>(number);
+                    }
+                    throw std::out_of_range("RyReflect: JSON number out of range");
+                }
+            },
+            jsonValue.value);
+#endif
+    }
+
     //  将基本类型转换为JsonValue的辅助函数
     template <typename T>
     JsonValue toJsonValue(const T& value)
@@ -884,13 +771,16 @@ namespace RyReflect
             return QString(value);
         }
 #endif
-        else if constexpr (std::is_arithmetic_v<T> || std::is_same_v<T, const char*>) {
+        else if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, const char*>) {
 #ifdef RY_USE_QT
             return QJsonValue(value);
 #else
             return JsonValue{ value };
 #endif
         }
+        else if constexpr (std::is_arithmetic_v<T>) {
+            return toJsonNumber(value);
+        }
         else if constexpr (is_container<T>::value) {
             // 对于容器，调用 toJsonArray
             return toJsonArray(value);
@@ -923,20 +813,6 @@ namespace RyReflect
             return jsonValue.toVariant().toByteArray();
         }
 #endif
-        else if constexpr (std::is_same_v<T, int>) {
-#ifdef RY_USE_QT
-            return jsonValue.toInt();
-#else
-            return std::get<int>(jsonValue.value);
-#endif
-        }
-        else if constexpr (std::is_same_v<T, double>) {
-#ifdef RY_USE_QT
-            return jsonValue.toDouble();
-#else
-            return std::get<double>(jsonValue.value);
-#endif
-        }
         else if constexpr (std::is_same_v<T, bool>) {
 #ifdef RY_USE_QT
             return jsonValue.toBool();
@@ -944,6 +820,9 @@ namespace RyReflect
             return std::get<bool>(jsonValue.value);
 #endif
         }
+        else if constexpr (std::is_arithmetic_v<T>) {
+            return fromJsonNumber<T>(jsonValue);
+        }
         else if constexpr (ForEachable<T>) {
             // 对于复杂类型，调用其静态 fromJson 方法
 #ifdef RY_USE_QT
@@ -961,21 +840,10 @@ namespace RyReflect
 #endif
         }
         else {
-            auto typeName = std::string(typeid(T).name());
-            static_assert(always_false<T>, "Unsupported type in fromJsonValue: ");
+            static_assert(always_false<T>, "Unsupported type in fromJsonValue");
         }
     }
 
-    // 对于 int64_t
-    template <>
-    inline int64_t fromJsonValue<int64_t>(const JsonValue& value) {
-#ifdef RY_USE_QT
-        return value.toInteger();
-#else
-        return value.toInt(); // 根据 JsonValue 的实际实现
-#endif
-    }
-
     // 将数组转换为JsonArray的辅助函数
     template <typename Container>
     JsonArray toJsonArray(const Container& container)
@@ -993,58 +861,1590 @@ namespace RyReflect
     {
         using T = typename Container::value_type;
         Container container;
+        if constexpr (requires { container.reserve(jsonArray.size()); }) {
+            container.reserve(jsonArray.size());
+        }
         for (const auto& jsonValue : jsonArray) {
             container.insert(container.end(), fromJsonValue<T>(jsonValue));
         }
         return container;
     }
 
-    // 定义RY_REFLECTABLE宏，用于在结构体中声明反射所需的成员函数
-#define RY_REFLECTABLE(TypeName, ...)                                                                                                                                                                  \
-    auto getMemberValues()                                                                                                                                                                             \
-    {                                                                                                                                                                                                  \
-        return std::tie(__VA_ARGS__);                                                                                                                                                                  \
-    }                                                                                                                                                                                                  \
-    auto getMemberValues() const                                                                                                                                                                       \
-    {                                                                                                                                                                                                  \
-        return std::tie(__VA_ARGS__);                                                                                                                                                                  \
-    }                                                                                                                                                                                                  \
-    constexpr static auto getMemberNames()                                                                                                                                                             \
-    {                                                                                                                                                                                                  \
-        return std::make_tuple(RYREFLECT_FOR_EACH(RYREFLECT_STRINGIZE, __VA_ARGS__));                                                                                                                  \
-    }                                                                                                                                                                                                  \
-    RyReflect::JsonObject toJson() const                                                                                                                                                               \
-    {                                                                                                                                                                                                  \
-        RyReflect::JsonObject json;                                                                                                                                                                    \
-        try {                                                                                                                                                                                          \
-            RyReflect::forEach(*this, [&json](const auto& name, const auto& value) {                                                                                                                   \
-                json[name] = RyReflect::toJsonValue(value);                                                                                                                                            \
-            });                                                                                                                                                                                        \
-        }                                                                                                                                                                                              \
-        catch (const std::exception& e) {                                                                                                                                                              \
-            std::cerr << "Error in toJson: " << e.what() << std::endl;                                                                                                                                 \
-            throw;                                                                                                                                                                                     \
-        }                                                                                                                                                                                              \
-        return json;                                                                                                                                                                                   \
-    }                                                                                                                                                                                                  \
-    static TypeName fromJson(const RyReflect::JsonObject& json)                                                                                                                                        \
-    {                                                                                                                                                                                                  \
-        TypeName obj;                                                                                                                                                                                  \
-        try {                                                                                                                                                                                          \
-            RyReflect::forEach(obj, [&json](const auto& name, auto& value) {                                                                                                                           \
-                if (json.contains(name)) {                                                                                                                                                             \
-                    value = RyReflect::fromJsonValue<std::remove_reference_t<decltype(value)>>(json.value(name));                                                                                      \
-                }                                                                                                                                                                                      \
-                else {                                                                                                                                                                                 \
-                    std::cerr << "Warning: Key '" << name << "' not found in JSON" << std::endl;                                                                                                       \
-                }                                                                                                                                                                                      \
-            });                                                                                                                                                                                        \
-        }                                                                                                                                                                                              \
-        catch (const std::exception& e) {                                                                                                                                                              \
-            std::cerr << "Error in fromJson: " << e.what() << std::endl;                                                                                                                               \
-            throw;                                                                                                                                                                                     \
-        }                                                                                                                                                                                              \
-        return obj;                                                                                                                                                                                    \
+    // 为即将写入的 count 个成员预留空间，QJsonObject 没有 reserve，此时不做任何事
+    inline void reserveJsonObject([[maybe_unused]] JsonObject& json, [[maybe_unused]] std::size_t count)
+    {
+#ifndef RY_USE_QT
+        json.reserve(count);
+#endif
+    }
+
+    // 按名称读取对象成员，只查找一次；成员不存在时返回 false
+    template <typename T>
+    bool readJsonMember(const JsonObject& json, const char* name, T& value)
+    {
+#ifdef RY_USE_QT
+        // 成员名是 C++ 标识符，按 Latin-1 查找不需要构造 QString
+        const auto it = json.constFind(QLatin1String(name));
+        if (it == json.constEnd()) {
+            return false;
+        }
+        value = fromJsonValue<T>(it.value());
+#else
+        const auto it = json.find(name);
+        if (it == json.end()) {
+            return false;
+        }
+        value = fromJsonValue<T>(it->second);
+#endif
+        return true;
     }
 
+    template <ForEachable T>
+    void fromJsonInto(T& obj, const JsonObject& json);
+
+    template <typename Container>
+    void readJsonArray(const JsonArray& jsonArray, Container& container);
+
+    // fromJsonValue 的原地版本：字符串复用已有容量，对象和容器逐个成员、逐个元素覆盖；
+    // null 保留 value 原有的值，与 readJson 一致
+    template <typename T>
+    void readJsonValue(const JsonValue& jsonValue, T& value)
+    {
+#ifdef RY_USE_QT
+        if (jsonValue.isNull()) {
+            return;
+        }
+#else
+        if (std::holds_alternative<std::nullptr_t>(jsonValue.value)) {
+            return;
+        }
+#endif
+        if constexpr (std::is_same_v<T, std::string>) {
+#ifdef RY_USE_QT
+            const QByteArray utf8 = jsonValue.toString().toUtf8();
+            value.assign(utf8.constData(), static_cast<std::size_t>(utf8.size()));
+#else
+            value.assign(std::get<std::string>(jsonValue.value));
+#endif
+        }
+#ifdef RY_USE_QT
+        else if constexpr (std::is_same_v<T, QString> || std::is_same_v<T, QByteArray>) {
+            value = fromJsonValue<T>(jsonValue);
+        }
+#endif
+        else if constexpr (ForEachable<T>) {
+#ifdef RY_USE_QT
+            fromJsonInto(value, jsonValue.toObject());
+#else
+            fromJsonInto(value, std::get<JsonObject>(jsonValue.value));
+#endif
+        }
+        else if constexpr (is_container<T>::value) {
+#ifdef RY_USE_QT
+            readJsonArray(jsonValue.toArray(), value);
+#else
+            readJsonArray(std::get<JsonArray>(jsonValue.value), value);
+#endif
+        }
+        else {
+            value = fromJsonValue<T>(jsonValue);
+        }
+    }
+
+    // fromJsonArray 的原地版本：按数组大小预留容量，复用容器中已有的元素，多余的元素被删除
+    template <typename Container>
+    void readJsonArray(const JsonArray& jsonArray, Container& container)
+    {
+        if constexpr (ReusableContainer<Container>) {
+            if constexpr (requires { container.reserve(jsonArray.size()); }) {
+                container.reserve(jsonArray.size());
+            }
+            auto it = container.begin();
+            for (const auto& jsonValue : jsonArray) {
+                readJsonValue(jsonValue, reuseContainerElement(container, it));
+            }
+            container.erase(it, container.end());
+        }
+        else {
+            container = fromJsonArray<Container>(jsonArray);
+        }
+    }
+
+    template <typename T, std::size_t... I>
+    constexpr auto makeMemberValueReaders(std::index_sequence<I...>)
+    {
+        using Reader = void (*)(const JsonValue&, T&);
+        return std::array<Reader, sizeof...(I)>{+[](const JsonValue& jsonValue, T& obj) { readJsonValue(jsonValue, std::get<I>(obj.getMemberValues())); }...};
+    }
+
+    // 按成员下标分派的原地读取函数表，配合 findMemberIndex 使用
+    template <typename T>
+    inline constexpr auto memberValueReaders = makeMemberValueReaders<T>(std::make_index_sequence<memberCount<T>>{});
+
+    // 用 json 中的成员原地覆盖 obj 的对应成员，字符串和容器成员复用已有的容量；
+    // json 中没有的成员保留原值，多余的键被忽略
+    template <ForEachable T>
+    void fromJsonInto(T& obj, const JsonObject& json)
+    {
+#ifdef RY_USE_QT
+        forEach(obj, [&json](const char* name, auto& value) {
+            const auto it = json.constFind(QLatin1String(name));
+            if (it != json.constEnd()) {
+                readJsonValue(it.value(), value);
+            }
+        });
+#else
+        // 遍历输入的成员并用编译期哈希表定位字段，而不是为每个字段查找一次 JsonObject
+        for (const auto& [key, jsonValue] : json) {
+            const std::size_t index = findMemberIndex<T>(key);
+            if (index < memberCount<T>) {
+                memberValueReaders<T>[index](jsonValue, obj);
+            }
+        }
+#endif
+    }
+
+    // 可以写入JSON文本的输出目标，std::string 即满足要求
+    template <typename Sink>
+    concept JsonSink = requires(Sink& sink, const char* data, std::size_t size, char ch) {
+        sink.append(data, size);
+        sink.push_back(ch);
+    };
+
+    // 编译期计算字符串按JSON规则转义后的长度（不含引号）
+    constexpr std::size_t escapedJsonLength(std::string_view str)
+    {
+        std::size_t length = 0;
+        for (const char c : str) {
+            const auto ch = static_cast<unsigned char>(c);
+            if (ch == '"' || ch == '\\' || ch == '\b' || ch == '\f' || ch == '\n' || ch == '\r' || ch == '\t') {
+                length += 2;
+            }
+            else if (ch < 0x20) {
+                length += 6;
+            }
+            else {
+                length += 1;
+            }
+        }
+        return length;
+    }
+
+    // 编译期转义字符串并写入 out，返回写入结束的位置
+    constexpr char* writeEscapedJson(std::string_view str, char* out)
+    {
+        constexpr char hex[] = "0123456789abcdef";
+        for (const char c : str) {
+            const auto ch = static_cast<unsigned char>(c);
+            switch (ch) {
+            case '"': *out++ = '\\'; *out++ = '"'; break;
+            case '\\': *out++ = '\\'; *out++ = '\\'; break;
+            case '\b': *out++ = '\\'; *out++ = 'b'; break;
+            case '\f': *out++ = '\\'; *out++ = 'f'; break;
+            case '\n': *out++ = '\\'; *out++ = 'n'; break;
+            case '\r': *out++ = '\\'; *out++ = 'r'; break;
+            case '\t': *out++ = '\\'; *out++ = 't'; break;
+            default:
+                if (ch < 0x20) {
+                    for (const char e : {'\\', 'u', '0', '0', hex[ch >> 4], hex[ch & 0xF]}) {
+                        *out++ = e;
+                    }
+                }
+                else {
+                    *out++ = c;
+                }
+                break;
+            }
+        }
+        return out;
+    }
+
+    // 反射类型的键片段表：第一个成员为 {"name":，其余成员为 ,"name":，转义和引号都在编译期完成
+    template <std::size_t Size, std::size_t Count>
+    struct MemberKeyFragments
+    {
+        std::array<char, Size>            data{};
+        std::array<std::size_t, Count + 1> offsets{};
+
+        constexpr std::string_view fragment(std::size_t index) const
+        {
+            return std::string_view(data.data() + offsets[index], offsets[index + 1] - offsets[index]);
+        }
+    };
+
+    template <typename T>
+    constexpr std::size_t memberKeyFragmentsSize()
+    {
+        std::size_t size = 0;
+        for (const auto& name : memberNameArray<T>()) {
+            size += escapedJsonLength(name) + 4; // 前导的 { 或 , 以及两个引号和冒号
+        }
+        return size;
+    }
+
+    template <typename T>
+    constexpr auto buildMemberKeyFragments()
+    {
+        constexpr auto names = memberNameArray<T>();
+        MemberKeyFragments<memberKeyFragmentsSize<T>(), names.size()> fragments;
+        char* out = fragments.data.data();
+        for (std::size_t i = 0; i < names.size(); ++i) {
+            fragments.offsets[i] = static_cast<std::size_t>(out - fragments.data.data());
+            *out++               = i == 0 ? '{' : ',';
+            *out++               = '"';
+            out                  = writeEscapedJson(names[i], out);
+            *out++               = '"';
+            *out++               = ':';
+        }
+        fragments.offsets[names.size()] = static_cast<std::size_t>(out - fragments.data.data());
+        return fragments;
+    }
+
+    // 写出对象时直接拷贝这些片段，不再逐个转义键名
+    template <typename T>
+    inline constexpr auto memberKeyFragments = buildMemberKeyFragments<T>();
+
+    // 返回从 pos 开始第一个需要特殊处理的字节位置：控制字符、引号、反斜杠或非ASCII字节，没有时返回 size
+    // 按 32/16 字节一组用 AVX2/SSE2 比较，最后不足一组的部分逐字节检查
+    inline std::size_t findJsonSpecialByte(const char* data, std::size_t pos, std::size_t size)
+    {
+#ifdef RYREFLECT_HAS_AVX2
+        {
+            const __m256i quote     = _mm256_set1_epi8('"');
+            const __m256i backslash = _mm256_set1_epi8('\\');
+            const __m256i space     = _mm256_set1_epi8(0x20);
+            for (; pos + 32 <= size; pos += 32) {
+                const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+                // 按有符号比较，小于 0x20 同时覆盖了控制字符和 0x80 以上的字节
+                const __m256i special = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote), _mm256_cmpeq_epi8(chunk, backslash)), _mm256_cmpgt_epi8(space, chunk));
+                const auto mask       = static_cast<std::uint32_t>(_mm256_movemask_epi8(special));
+                if (mask != 0) {
+                    return pos + static_cast<std::size_t>(std::countr_zero(mask));
+                }
+            }
+        }
+#endif
+#ifdef RYREFLECT_HAS_SSE2
+        {
+            const __m128i quote     = _mm_set1_epi8('"');
+            const __m128i backslash = _mm_set1_epi8('\\');
+            const __m128i space     = _mm_set1_epi8(0x20);
+            for (; pos + 16 <= size; pos += 16) {
+                const __m128i chunk   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+                const __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)), _mm_cmplt_epi8(chunk, space));
+                const auto mask       = static_cast<std::uint32_t>(_mm_movemask_epi8(special));
+                if (mask != 0) {
+                    return pos + static_cast<std::size_t>(std::countr_zero(mask));
+                }
+            }
+        }
+#endif
+        for (; pos < size; ++pos) {
+            const auto ch = static_cast<unsigned char>(data[pos]);
+            if (ch < 0x20 || ch >= 0x80 || ch == '"' || ch == '\\') {
+                return pos;
+            }
+        }
+        return size;
+    }
+
+    // 检查 data 开头是否为一个合法的多字节 UTF-8 序列，返回其长度，不合法时返回 0
+    inline std::size_t utf8SequenceLength(const unsigned char* data, std::size_t size)
+    {
+        const unsigned char lead = data[0];
+        std::size_t length       = 0;
+        unsigned char low        = 0x80;
+        unsigned char high       = 0xBF;
+        if (lead >= 0xC2 && lead <= 0xDF) {
+            length = 2;
+        }
+        else if (lead >= 0xE0 && lead <= 0xEF) {
+            length = 3;
+            low    = lead == 0xE0 ? 0xA0 : 0x80; // 排除过长编码
+            high   = lead == 0xED ? 0x9F : 0xBF; // 排除代理项
+        }
+        else if (lead >= 0xF0 && lead <= 0xF4) {
+            length = 4;
+            low    = lead == 0xF0 ? 0x90 : 0x80;
+            high   = lead == 0xF4 ? 0x8F : 0xBF;
+        }
+        if (length == 0 || size < length || data[1] < low || data[1] > high) {
+            return 0;
+        }
+        for (std::size_t i = 2; i < length; ++i) {
+            if ((data[i] & 0xC0) != 0x80) {
+                return 0;
+            }
+        }
+        return length;
+    }
+
+    // 写入带引号并转义的JSON字符串。不需要转义的连续片段整段拷贝，
+    // 非法的 UTF-8 字节替换为 U+FFFD，与 Qt 路径上 QString::fromStdString 的行为一致
+    template <JsonSink Sink>
+    void writeJsonString(Sink& sink, std::string_view str)
+    {
+        static constexpr char hex[] = "0123456789abcdef";
+        const char* data            = str.data();
+        const std::size_t size      = str.size();
+        sink.push_back('"');
+        std::size_t begin = 0;
+        std::size_t pos   = 0;
+        while ((pos = findJsonSpecialByte(data, pos, size)) != size) {
+            const auto ch = static_cast<unsigned char>(data[pos]);
+            if (ch >= 0x80) {
+                // 连续的非ASCII字符在这里逐个校验，合法的序列留在当前片段中一起拷贝
+                std::size_t length = 0;
+                while (pos < size && static_cast<unsigned char>(data[pos]) >= 0x80 &&
+                       (length = utf8SequenceLength(reinterpret_cast<const unsigned char*>(data) + pos, size - pos)) != 0) {
+                    pos += length;
+                }
+                if (pos == size || static_cast<unsigned char>(data[pos]) < 0x80) {
+                    continue;
+                }
+                sink.append(data + begin, pos - begin);
+                sink.append("\xEF\xBF\xBD", 3);
+                begin = ++pos;
+                continue;
+            }
+            sink.append(data + begin, pos - begin);
+            begin = pos + 1;
+            switch (ch) {
+            case '"': sink.append("\\\"", 2); break;
+            case '\\': sink.append("\\\\", 2); break;
+            case '\b': sink.append("\\b", 2); break;
+            case '\f': sink.append("\\f", 2); break;
+            case '\n': sink.append("\\n", 2); break;
+            case '\r': sink.append("\\r", 2); break;
+            case '\t': sink.append("\\t", 2); break;
+            default: {
+                const char escaped[] = {'\\', 'u', '0', '0', hex[ch >> 4], hex[ch & 0xF]};
+                sink.append(escaped, sizeof(escaped));
+                break;
+            }
+            }
+            ++pos;
+        }
+        sink.append(data + begin, size - begin);
+        sink.push_back('"');
+    }
+
+    // 写入数值，整数与浮点数都使用 std::to_chars，不受 locale 影响
+    template <JsonSink Sink, typename T>
+    void writeJsonNumber(Sink& sink, T value)
+    {
+        if constexpr (std::is_floating_point_v<T>) {
+            // JSON 无法表示 NaN 和无穷大
+            if (!std::isfinite(value)) {
+                sink.append("null", 4);
+                return;
+            }
+        }
+        char buffer[32];
+        const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        sink.append(buffer, static_cast<std::size_t>(result.ptr - buffer));
+    }
+
+    template <typename T, JsonSink Sink>
+    void writeJson(const T& value, Sink& sink);
+
+    // 依次写出各成员，键使用编译期生成的片段
+    template <typename T, JsonSink Sink, std::size_t... I>
+    void writeJsonMembers(const T& obj, Sink& sink, std::index_sequence<I...>)
+    {
+        constexpr auto& fragments = memberKeyFragments<T>;
+        const auto values         = obj.getMemberValues();
+        ((sink.append(fragments.fragment(I).data(), fragments.fragment(I).size()), writeJson(std::get<I>(values), sink)), ...);
+    }
+
+    // 将值直接写为紧凑的JSON文本，类型分派与 toJsonValue 保持一致，但不构建 JsonObject
+    template <typename T, JsonSink Sink>
+    void writeJson(const T& value, Sink& sink)
+    {
+        if constexpr (std::is_same_v<T, std::string>) {
+            writeJsonString(sink, value);
+        }
+#ifdef RY_USE_QT
+        else if constexpr (std::is_same_v<T, QString>) {
+            const QByteArray utf8 = value.toUtf8();
+            writeJsonString(sink, std::string_view(utf8.constData(), static_cast<std::size_t>(utf8.size())));
+        }
+        else if constexpr (std::is_same_v<T, QByteArray>) {
+            writeJsonString(sink, std::string_view(value.constData(), static_cast<std::size_t>(value.size())));
+        }
+#endif
+        else if constexpr (std::is_same_v<T, const char*>) {
+            writeJsonString(sink, value);
+        }
+        else if constexpr (std::is_same_v<T, bool>) {
+            if (value) {
+                sink.append("true", 4);
+            }
+            else {
+                sink.append("false", 5);
+            }
+        }
+        else if constexpr (std::is_arithmetic_v<T>) {
+            writeJsonNumber(sink, value);
+        }
+        else if constexpr (is_container<T>::value) {
+            sink.push_back('[');
+            bool first = true;
+            for (const auto& item : value) {
+                if (!first) {
+                    sink.push_back(',');
+                }
+                first = false;
+                writeJson(item, sink);
+            }
+            sink.push_back(']');
+        }
+        else if constexpr (ForEachable<T>) {
+            if constexpr (memberCount<T> == 0) {
+                sink.append("{}", 2);
+            }
+            else {
+                writeJsonMembers(value, sink, std::make_index_sequence<memberCount<T>>{});
+                sink.push_back('}');
+            }
+        }
+        else {
+            static_assert(always_false<T>, "Unsupported type in writeJson");
+        }
+    }
+
+    // 序列化到调用方持有的缓冲区，复用其已有容量
+    template <typename T>
+    void toJsonString(const T& obj, std::string& out)
+    {
+        out.clear();
+        writeJson(obj, out);
+    }
+
+    template <typename T>
+    std::string toJsonString(const T& obj)
+    {
+        std::string out;
+        writeJson(obj, out);
+        return out;
+    }
+
+    // JSON 文本解析错误，offset 为出错位置在输入中的字节偏移
+    class JsonParseError : public std::runtime_error
+    {
+    public:
+        JsonParseError(const std::string& message, std::size_t offset)
+            : std::runtime_error(message + " at offset " + std::to_string(offset))
+            , m_offset(offset)
+        { }
+
+        std::size_t offset() const { return m_offset; }
+
+    private:
+        std::size_t m_offset;
+    };
+
+    // tryFromJson 返回的错误类别
+    enum class JsonErrorCode : std::uint8_t
+    {
+        Syntax,        // 不是合法的JSON
+        TypeMismatch,  // 值的类型与成员类型不符
+        OutOfRange,    // 数字超出成员类型的范围
+        UnexpectedEnd, // 输入不完整
+        TooDeep,       // 嵌套层数超过限制
+    };
+
+    struct JsonError
+    {
+        JsonErrorCode code;
+        const char*   message; // 与 JsonParseError 相同的静态描述
+        std::size_t   offset;
+        std::string   path;    // 出错的值在文档中的路径，如 $.items[3].name
+    };
+
+    // 计算 offset 处的值在文档中的路径。只在出错后调用，从头扫描到 offset，只跟踪括号、引号、逗号与键
+    inline std::string jsonPathAt(std::string_view text, std::size_t offset)
+    {
+        struct Frame
+        {
+            bool             object;
+            bool             expectKey;
+            std::size_t      index;
+            std::string_view key;
+        };
+        std::vector<Frame> frames;
+        offset = std::min(offset, text.size());
+        for (std::size_t i = 0; i < offset; ++i) {
+            const char ch = text[i];
+            if (ch == '"') {
+                const std::size_t begin = i + 1;
+                for (++i; i < offset && text[i] != '"'; ++i) {
+                    if (text[i] == '\\') {
+                        ++i;
+                    }
+                }
+                if (!frames.empty() && frames.back().object && frames.back().expectKey) {
+                    frames.back().key = text.substr(begin, std::min(i, text.size()) - begin);
+                }
+            }
+            else if (ch == '{' || ch == '[') {
+                frames.push_back(Frame{ ch == '{', ch == '{', 0, {} });
+            }
+            else if ((ch == '}' || ch == ']') && !frames.empty()) {
+                frames.pop_back();
+            }
+            else if (ch == ',' && !frames.empty()) {
+                ++frames.back().index;
+                frames.back().expectKey = frames.back().object;
+                frames.back().key       = {};
+            }
+            else if (ch == ':' && !frames.empty()) {
+                frames.back().expectKey = false;
+            }
+        }
+        std::string path = "$";
+        for (const Frame& frame : frames) {
+            if (!frame.object) {
+                path += '[';
+                path += std::to_string(frame.index);
+                path += ']';
+            }
+            else if (!frame.key.empty()) {
+                path += '.';
+                path += frame.key;
+            }
+        }
+        return path;
+    }
+
+    // 诊断事件。生成的 fromJson 找不到某个键时发出 MissingKey，tryFromJson 失败时发出 ParseError
+    enum class DiagnosticKind : std::uint8_t
+    {
+        MissingKey,
+        ParseError,
+    };
+
+    struct Diagnostic
+    {
+        DiagnosticKind   kind;
+        std::string_view type;    // MissingKey：所属的类型名
+        std::string_view path;    // MissingKey：键名；ParseError：出错的路径
+        std::string_view message;
+    };
+
+    using DiagnosticHandler = void (*)(const Diagnostic&);
+
+    inline std::atomic<DiagnosticHandler> diagnosticHandler{ nullptr };
+
+    // 设置诊断回调，默认为空，即不输出任何信息。回调可能在多个线程中同时调用
+    inline void setDiagnosticHandler(DiagnosticHandler handler) { diagnosticHandler.store(handler, std::memory_order_release); }
+
+    inline void reportDiagnostic(const Diagnostic& diagnostic)
+    {
+        if (const DiagnosticHandler handler = diagnosticHandler.load(std::memory_order_acquire)) {
+            handler(diagnostic);
+        }
+    }
+
+    // 单遍扫描的JSON词法读取器，出错时记录错误并停止前进，由调用方在边界处检查 ok()
+    class JsonReader
+    {
+    public:
+        explicit JsonReader(std::string_view text)
+            : m_begin(text.data())
+            , m_pos(text.data())
+            , m_end(text.data() + text.size())
+        { }
+
+        bool ok() const { return m_error == nullptr; }
+        const char* errorMessage() const { return m_error; }
+        JsonErrorCode errorCode() const { return m_errorCode; }
+        std::size_t errorOffset() const { return m_errorOffset; }
+        std::size_t offset() const { return static_cast<std::size_t>(m_pos - m_begin); }
+
+        // 移动到输入中的指定位置继续读取
+        void seek(std::size_t offset) { m_pos = m_error == nullptr ? m_begin + offset : m_end; }
+
+        // 记录第一个错误及其类别，并把读取位置移到末尾，使后续读取全部失败
+        void fail(const char* message, JsonErrorCode code = JsonErrorCode::Syntax)
+        {
+            if (m_error == nullptr) {
+                m_error       = message;
+                m_errorCode   = code;
+                m_errorOffset = offset();
+            }
+            m_pos = m_end;
+        }
+
+        // 对象和数组的最大嵌套层数，与 JsonIndexedParser 相同，避免递归解码深层输入时耗尽栈空间
+        static constexpr std::size_t maxDepth = 1024;
+
+        // 进入一层对象或数组，超过 maxDepth 时记录错误并返回 false；返回 true 时需要与 leave 成对调用
+        bool enter()
+        {
+            if (m_depth == maxDepth) {
+                fail("document too deep", JsonErrorCode::TooDeep);
+                return false;
+            }
+            ++m_depth;
+            return true;
+        }
+
+        void leave() { --m_depth; }
+
+        void skipWhitespace()
+        {
+            while (m_pos != m_end && (*m_pos == ' ' || *m_pos == '\n' || *m_pos == '\r' || *m_pos == '\t')) {
+                ++m_pos;
+            }
+        }
+
+        // 跳过空白后返回下一个字符，到达末尾时返回 '\0'
+        char peek()
+        {
+            skipWhitespace();
+            return m_pos == m_end ? '\0' : *m_pos;
+        }
+
+        bool atEnd()
+        {
+            skipWhitespace();
+            return m_pos == m_end;
+        }
+
+        // 下一个字符是 ch 时消费它并返回 true
+        bool consume(char ch)
+        {
+            if (peek() == ch) {
+                ++m_pos;
+                return true;
+            }
+            return false;
+        }
+
+        bool expect(char ch, const char* message, JsonErrorCode code = JsonErrorCode::Syntax)
+        {
+            if (consume(ch)) {
+                return true;
+            }
+            fail(message, code);
+            return false;
+        }
+
+        // 读取字符串到 out，out 的已有容量会被复用
+        bool readString(std::string& out)
+        {
+            out.clear();
+            std::string_view view;
+            if (!readStringView(view, out)) {
+                return false;
+            }
+            if (view.data() != out.data()) {
+                out.assign(view);
+            }
+            return true;
+        }
+
+        // 读取字符串；没有转义字符时直接返回指向输入的视图，否则反转义到 scratch 中
+        bool readStringView(std::string_view& out, std::string& scratch)
+        {
+            if (!expect('"', "expected string", JsonErrorCode::TypeMismatch)) {
+                return false;
+            }
+            const char* start = m_pos;
+            skipPlainStringChars();
+            if (m_pos != m_end && *m_pos == '"') {
+                out = std::string_view(start, static_cast<std::size_t>(m_pos - start));
+                ++m_pos;
+                return true;
+            }
+            scratch.assign(start, m_pos);
+            if (!unescapeRest(scratch)) {
+                return false;
+            }
+            out = scratch;
+            return true;
+        }
+
+        // 读取数字的原始文本，不做转换。按 RFC 8259 的语法检查：-? (0 | [1-9][0-9]*) (.[0-9]+)? ([eE][+-]?[0-9]+)?，
+        // 拒绝前导零、前导 + 号以及缺少数字的小数和指数
+        bool readNumberToken(std::string_view& out)
+        {
+            skipWhitespace();
+            const char* start = m_pos;
+            if (m_pos == m_end || (*m_pos != '-' && !isDigit(*m_pos))) {
+                fail("expected number", JsonErrorCode::TypeMismatch);
+                return false;
+            }
+            const char* p = m_pos;
+            if (*p == '-') {
+                ++p;
+            }
+            bool valid = p != m_end && isDigit(*p);
+            if (valid && *p++ == '0') {
+                valid = p == m_end || !isDigit(*p);
+            }
+            p = skipDigits(p);
+            if (valid && p != m_end && *p == '.') {
+                valid = ++p != m_end && isDigit(*p);
+                p     = skipDigits(p);
+            }
+            if (valid && p != m_end && (*p == 'e' || *p == 'E')) {
+                if (++p != m_end && (*p == '+' || *p == '-')) {
+                    ++p;
+                }
+                valid = p != m_end && isDigit(*p);
+                p     = skipDigits(p);
+            }
+            // 数字后紧跟的数字字符说明语法不完整，例如 1.2.3、1e5e5
+            if (!valid || (p != m_end && (*p == '.' || *p == '+' || *p == '-' || *p == 'e' || *p == 'E'))) {
+                fail("invalid number");
+                return false;
+            }
+            m_pos = p;
+            out   = std::string_view(start, static_cast<std::size_t>(m_pos - start));
+            return true;
+        }
+
+        // 使用 std::from_chars 转换数字，整数目标也接受可精确表示的浮点写法（如 1.0、1e3）
+        template <typename T>
+        bool readNumber(T& out)
+        {
+            std::string_view token;
+            if (!readNumberToken(token)) {
+                return false;
+            }
+            const char* first = token.data();
+            const char* last  = token.data() + token.size();
+            auto result = std::from_chars(first, last, out);
+            if (result.ec == std::errc() && result.ptr == last) {
+                return true;
+            }
+            if constexpr (std::is_integral_v<T>) {
+                double number = 0;
+                result        = std::from_chars(first, last, number);
+                if (result.ec == std::errc() && result.ptr == last) {
+                    if (fitsInteger<T>(number)) {
+                        out = static_cast<T>(number);
+                        return true;
+                    }
+                    // 整数值超出 T 的范围
+                    if (std::trunc(number) == number) {
+                        result.ec = std::errc::result_out_of_range;
+                    }
+                }
+            }
+            m_pos = first;
+            if (result.ec == std::errc::result_out_of_range) {
+                fail("number out of range", JsonErrorCode::OutOfRange);
+            }
+            else {
+                fail("invalid number");
+            }
+            return false;
+        }
+
+        bool readBool(bool& out)
+        {
+            if (consumeLiteral("true")) {
+                out = true;
+                return true;
+            }
+            if (consumeLiteral("false")) {
+                out = false;
+                return true;
+            }
+            fail("expected boolean", JsonErrorCode::TypeMismatch);
+            return false;
+        }
+
+        // 下一个值是 null 时消费它并返回 true
+        bool consumeNull() { return peek() == 'n' && consumeLiteral("null"); }
+
+        // 跳过一个完整的值，只匹配括号与引号，不解析其内容
+        bool skipValue()
+        {
+            const char ch = peek();
+            if (ch == '"') {
+                return skipString();
+            }
+            if (ch != '{' && ch != '[') {
+                if (ch == 't' || ch == 'f') {
+                    bool ignored;
+                    return readBool(ignored);
+                }
+                if (ch == 'n') {
+                    if (!consumeNull()) {
+                        fail("invalid literal");
+                    }
+                    return ok();
+                }
+                std::string_view ignored;
+                return readNumberToken(ignored);
+            }
+            return skipNested(0);
+        }
+
+        // 已读过对象的部分成员后，跳过剩余的成员直到与之匹配的 '}'，同样只匹配括号与引号
+        bool skipObjectRest() { return skipNested(1); }
+
+    private:
+        static bool isDigit(char ch) { return ch >= '0' && ch <= '9'; }
+
+        const char* skipDigits(const char* p) const
+        {
+            while (p != m_end && isDigit(*p)) {
+                ++p;
+            }
+            return p;
+        }
+
+        // 从当前嵌套深度 depth 开始向后扫描，直到深度回到 0
+        bool skipNested(std::size_t depth)
+        {
+            while (m_pos != m_end) {
+                const char c = *m_pos;
+                if (c == '"') {
+                    if (!skipString()) {
+                        return false;
+                    }
+                    continue;
+                }
+                ++m_pos;
+                if (c == '{' || c == '[') {
+                    ++depth;
+                }
+                else if (c == '}' || c == ']') {
+                    if (--depth == 0) {
+                        return true;
+                    }
+                }
+            }
+            fail("unterminated value", JsonErrorCode::UnexpectedEnd);
+            return false;
+        }
+
+        // 跳过字符串中不需要处理的字符，停在引号、反斜杠、控制字符或末尾；ASCII 部分按SIMD分组扫描
+        void skipPlainStringChars()
+        {
+            const auto size = static_cast<std::size_t>(m_end - m_begin);
+            auto pos        = static_cast<std::size_t>(m_pos - m_begin);
+            while ((pos = findJsonSpecialByte(m_begin, pos, size)) != size && static_cast<unsigned char>(m_begin[pos]) >= 0x80) {
+                ++pos;
+            }
+            m_pos = m_begin + pos;
+        }
+
+        bool consumeLiteral(std::string_view literal)
+        {
+            skipWhitespace();
+            if (static_cast<std::size_t>(m_end - m_pos) >= literal.size() && std::string_view(m_pos, literal.size()) == literal) {
+                m_pos += literal.size();
+                return true;
+            }
+            return false;
+        }
+
+        bool skipString()
+        {
+            ++m_pos;
+            while (m_pos != m_end) {
+                const char c = *m_pos++;
+                if (c == '"') {
+                    return true;
+                }
+                if (c == '\\') {
+                    if (m_pos == m_end) {
+                        break;
+                    }
+                    ++m_pos;
+                }
+            }
+            fail("unterminated string", JsonErrorCode::UnexpectedEnd);
+            return false;
+        }
+
+        bool readHex4(std::uint32_t& out)
+        {
+            if (m_end - m_pos < 4) {
+                fail("invalid unicode escape");
+                return false;
+            }
+            out = 0;
+            for (int i = 0; i < 4; ++i) {
+                const char c = *m_pos++;
+                out <<= 4;
+                if (isDigit(c)) {
+                    out |= static_cast<std::uint32_t>(c - '0');
+                }
+                else if (c >= 'a' && c <= 'f') {
+                    out |= static_cast<std::uint32_t>(c - 'a' + 10);
+                }
+                else if (c >= 'A' && c <= 'F') {
+                    out |= static_cast<std::uint32_t>(c - 'A' + 10);
+                }
+                else {
+                    fail("invalid unicode escape");
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static void appendUtf8(std::string& out, std::uint32_t cp)
+        {
+            if (cp < 0x80) {
+                out.push_back(static_cast<char>(cp));
+            }
+            else if (cp < 0x800) {
+                out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+                out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+            }
+            else if (cp < 0x10000) {
+                out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+                out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+            }
+            else {
+                out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+                out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+            }
+        }
+
+        // 从当前位置继续读取字符串剩余部分，处理转义序列，结果追加到 out
+        bool unescapeRest(std::string& out)
+        {
+            while (m_pos != m_end) {
+                const char* start = m_pos;
+                skipPlainStringChars();
+                out.append(start, m_pos);
+                if (m_pos == m_end) {
+                    break;
+                }
+                const char c = *m_pos++;
+                if (c == '"') {
+                    return true;
+                }
+                if (c != '\\') {
+                    --m_pos;
+                    fail("control character in string");
+                    return false;
+                }
+                if (m_pos == m_end) {
+                    break;
+                }
+                switch (*m_pos++) {
+                case '"': out.push_back('"'); break;
+                case '\\': out.push_back('\\'); break;
+                case '/': out.push_back('/'); break;
+                case 'b': out.push_back('\b'); break;
+                case 'f': out.push_back('\f'); break;
+                case 'n': out.push_back('\n'); break;
+                case 'r': out.push_back('\r'); break;
+                case 't': out.push_back('\t'); break;
+                case 'u': {
+                    std::uint32_t cp = 0;
+                    if (!readHex4(cp)) {
+                        return false;
+                    }
+                    if (cp >= 0xD800 && cp <= 0xDBFF) {
+                        std::uint32_t low = 0;
+                        if (m_end - m_pos < 2 || m_pos[0] != '\\' || m_pos[1] != 'u') {
+                            fail("invalid surrogate pair");
+                            return false;
+                        }
+                        m_pos += 2;
+                        if (!readHex4(low)) {
+                            return false;
+                        }
+                        if (low < 0xDC00 || low > 0xDFFF) {
+                            fail("invalid surrogate pair");
+                            return false;
+                        }
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+                        fail("invalid surrogate pair");
+                        return false;
+                    }
+                    appendUtf8(out, cp);
+                    break;
+                }
+                default: --m_pos; fail("invalid escape"); return false;
+                }
+            }
+            fail("unterminated string", JsonErrorCode::UnexpectedEnd);
+            return false;
+        }
+
+        const char* m_begin;
+        const char* m_pos;
+        const char* m_end;
+        const char*   m_error       = nullptr;
+        JsonErrorCode m_errorCode   = JsonErrorCode::Syntax;
+        std::size_t   m_errorOffset = 0;
+        std::size_t   m_depth       = 0;
+    };
+
+    template <typename T>
+    void readJson(JsonReader& reader, T& value);
+
+    template <typename T, std::size_t... I>
+    constexpr auto makeMemberReaders(std::index_sequence<I...>)
+    {
+        using Reader = void (*)(JsonReader&, T&);
+        return std::array<Reader, sizeof...(I)>{+[](JsonReader& reader, T& obj) { readJson(reader, std::get<I>(obj.getMemberValues())); }...};
+    }
+
+    // 按成员下标分派的读取函数表，配合 findMemberIndex 使用
+    template <typename T>
+    inline constexpr auto memberReaders = makeMemberReaders<T>(std::make_index_sequence<memberCount<T>>{});
+
+    // 从 reader 中读取一个值直接写入 value，类型分派与 fromJsonValue 保持一致，不构建 JsonValue
+    // null 会保留 value 原有的值
+    template <typename T>
+    void readJson(JsonReader& reader, T& value)
+    {
+        if (reader.consumeNull()) {
+            return;
+        }
+        if constexpr (std::is_same_v<T, std::string>) {
+            reader.readString(value);
+        }
+#ifdef RY_USE_QT
+        else if constexpr (std::is_same_v<T, QString> || std::is_same_v<T, QByteArray>) {
+            std::string str;
+            std::string_view view;
+            if (reader.readStringView(view, str)) {
+                if constexpr (std::is_same_v<T, QString>) {
+                    value = QString::fromUtf8(view.data(), static_cast<qsizetype>(view.size()));
+                }
+                else {
+                    value = QByteArray(view.data(), static_cast<qsizetype>(view.size()));
+                }
+            }
+        }
+#endif
+        else if constexpr (std::is_same_v<T, bool>) {
+            reader.readBool(value);
+        }
+        else if constexpr (std::is_arithmetic_v<T>) {
+            reader.readNumber(value);
+        }
+        else if constexpr (ForEachable<T>) {
+            if (!reader.expect('{', "expected object", JsonErrorCode::TypeMismatch) || !reader.enter()) {
+                return;
+            }
+            if (!reader.consume('}')) {
+                std::string scratch;
+                do {
+                    std::string_view key;
+                    if (!reader.readStringView(key, scratch) || !reader.expect(':', "expected ':'")) {
+                        break;
+                    }
+                    const std::size_t index = findMemberIndex<T>(key);
+                    if (index < memberCount<T>) {
+                        memberReaders<T>[index](reader, value);
+                    }
+                    else {
+                        reader.skipValue();
+                    }
+                } while (reader.ok() && reader.consume(','));
+                reader.expect('}', "expected ',' or '}'");
+            }
+            reader.leave();
+        }
+        else if constexpr (is_container<T>::value) {
+            if (!reader.expect('[', "expected array", JsonErrorCode::TypeMismatch) || !reader.enter()) {
+                return;
+            }
+            if constexpr (ReusableContainer<T>) {
+                // 复用已有的元素，文本中的元素个数事先未知，多余的元素在结束时删除
+                auto it = value.begin();
+                if (!reader.consume(']')) {
+                    do {
+                        readJson(reader, reuseContainerElement(value, it));
+                    } while (reader.ok() && reader.consume(','));
+                    reader.expect(']', "expected ',' or ']'");
+                }
+                value.erase(it, value.end());
+            }
+            else {
+                value.clear();
+                if (!reader.consume(']')) {
+                    do {
+                        typename T::value_type item{};
+                        readJson(reader, item);
+                        value.insert(value.end(), std::move(item));
+                    } while (reader.ok() && reader.consume(','));
+                    reader.expect(']', "expected ',' or ']'");
+                }
+            }
+            reader.leave();
+        }
+        else {
+            static_assert(always_false<T>, "Unsupported type in readJson");
+        }
+    }
+
+    // 直接从JSON文本解析出对象，单遍扫描且不构建中间的 JsonObject，格式错误时抛出 JsonParseError
+    template <typename T>
+    T fromJsonString(std::string_view text)
+    {
+        T obj{};
+        JsonReader reader(text);
+        readJson(reader, obj);
+        if (reader.ok() && !reader.atEnd()) {
+            reader.fail("unexpected trailing characters");
+        }
+        if (!reader.ok()) {
+            throw JsonParseError(reader.errorMessage(), reader.errorOffset());
+        }
+        return obj;
+    }
+
+    // fromJsonString 的原地版本：直接覆盖 obj 的成员，字符串和容器复用已有的容量与元素，
+    // 反复解码同一类型时几乎不需要分配内存。文本中没有的成员保留原值；格式错误时抛出 JsonParseError，此时 obj 可能已被部分修改
+    template <typename T>
+    void fromJsonInto(T& obj, std::string_view text)
+    {
+        JsonReader reader(text);
+        readJson(reader, obj);
+        if (reader.ok() && !reader.atEnd()) {
+            reader.fail("unexpected trailing characters");
+        }
+        if (!reader.ok()) {
+            throw JsonParseError(reader.errorMessage(), reader.errorOffset());
+        }
+    }
+
+    // 部分解码时选择的成员，路径用 '.' 分隔嵌套的成员，如 "meta.ts"。
+    // 路径作用于容器时表示容器中的每个元素；空的掩码表示选择全部成员
+    class FieldMask
+    {
+    public:
+        FieldMask() = default;
+
+        FieldMask(std::initializer_list<std::string_view> paths)
+        {
+            for (const std::string_view path : paths) {
+                add(path);
+            }
+        }
+
+        // 添加一条路径；已选择整个成员时，再选择其中的子成员不改变结果
+        void add(std::string_view path);
+
+        bool all() const { return m_children.empty(); }
+        std::size_t size() const { return m_children.size(); }
+
+        // 返回选择了 key 的子项下标，未选择时返回 size()
+        std::size_t indexOf(std::string_view key) const;
+        const std::string& name(std::size_t index) const;
+        const FieldMask& child(std::size_t index) const;
+
+    private:
+        struct Child;
+        std::vector<Child> m_children;
+    };
+
+    struct FieldMask::Child
+    {
+        std::string name;
+        FieldMask   mask;
+    };
+
+    inline void FieldMask::add(std::string_view path)
+    {
+        const std::size_t dot       = path.find('.');
+        const std::string_view name = path.substr(0, dot);
+        const std::string_view rest = dot == std::string_view::npos ? std::string_view() : path.substr(dot + 1);
+        const std::size_t index     = indexOf(name);
+        if (index == m_children.size()) {
+            m_children.push_back(Child{ std::string(name), {} });
+            if (!rest.empty()) {
+                m_children.back().mask.add(rest);
+            }
+        }
+        else if (rest.empty()) {
+            m_children[index].mask.m_children.clear();
+        }
+        else if (!m_children[index].mask.all()) {
+            m_children[index].mask.add(rest);
+        }
+    }
+
+    inline std::size_t FieldMask::indexOf(std::string_view key) const
+    {
+        for (std::size_t i = 0; i < m_children.size(); ++i) {
+            if (m_children[i].name == key) {
+                return i;
+            }
+        }
+        return m_children.size();
+    }
+
+    inline const std::string& FieldMask::name(std::size_t index) const { return m_children[index].name; }
+
+    inline const FieldMask& FieldMask::child(std::size_t index) const { return m_children[index].mask; }
+
+    // 编译期写出的选择，部分解码时用 static_assert 检查每条路径都是 T 的成员
+    template <FixedString... Paths>
+    struct FieldSelection
+    {
+        static const FieldMask& mask()
+        {
+            static const FieldMask value{ Paths.view()... };
+            return value;
+        }
+
+        operator const FieldMask&() const { return mask(); }
+    };
+
+    // 编译期写出的选择，如 fromJsonString<Order>(text, fields<"id", "meta.ts">)
+    template <FixedString... Paths>
+    inline constexpr FieldSelection<Paths...> fields{};
+
+    // 元素为对象或容器的容器，路径作用于其中的每个元素；字符串等其余类型整体读取
+    template <typename T>
+    concept ProjectableContainer = is_container<T>::value && (ForEachable<typename T::value_type> || is_container<typename T::value_type>::value);
+
+    // path 是否指向 T 的成员，容器中的路径作用于每个元素
+    template <typename T>
+    constexpr bool isFieldPath(std::string_view path)
+    {
+        if constexpr (ForEachable<T>) {
+            // 逐字符查找而不用 find：GCC 12 无法在常量求值中对模板参数字符串调用 string_view::find
+            std::size_t dot = 0;
+            while (dot < path.size() && path[dot] != '.') {
+                ++dot;
+            }
+            const std::size_t index = findMemberIndex<T>(path.substr(0, dot));
+            if (index >= memberCount<T>) {
+                return false;
+            }
+            if (dot == path.size()) {
+                return true;
+            }
+            const std::string_view rest = path.substr(dot + 1);
+            return [&]<std::size_t... I>(std::index_sequence<I...>) { return ((I == index && isFieldPath<MemberType<T, I>>(rest)) || ...); }(std::make_index_sequence<memberCount<T>>{});
+        }
+        else if constexpr (ProjectableContainer<T>) {
+            return isFieldPath<typename T::value_type>(path);
+        }
+        else {
+            return false;
+        }
+    }
+
+    template <typename T>
+    void checkFieldMask(const FieldMask& mask, const std::string& prefix);
+
+    template <typename T, std::size_t... I>
+    constexpr auto makeMemberFieldCheckers(std::index_sequence<I...>)
+    {
+        using Checker = void (*)(const FieldMask&, const std::string&);
+        return std::array<Checker, sizeof...(I)>{+[](const FieldMask& mask, const std::string& prefix) { checkFieldMask<MemberType<T, I>>(mask, prefix); }...};
+    }
+
+    template <typename T>
+    inline constexpr auto memberFieldCheckers = makeMemberFieldCheckers<T>(std::make_index_sequence<memberCount<T>>{});
+
+    // 检查运行时构造的选择，路径不是 T 的成员时抛出 std::invalid_argument；prefix 为已经走过的路径，用于错误信息
+    template <typename T>
+    void checkFieldMask(const FieldMask& mask, const std::string& prefix)
+    {
+        if (mask.all()) {
+            return;
+        }
+        if constexpr (ForEachable<T>) {
+            for (std::size_t i = 0; i < mask.size(); ++i) {
+                const std::size_t index = findMemberIndex<T>(mask.name(i));
+                if (index == memberCount<T>) {
+                    throw std::invalid_argument("RyReflect: unknown field path \"" + prefix + mask.name(i) + "\"");
+                }
+                memberFieldCheckers<T>[index](mask.child(i), prefix + mask.name(i) + ".");
+            }
+        }
+        else if constexpr (ProjectableContainer<T>) {
+            checkFieldMask<typename T::value_type>(mask, prefix);
+        }
+        else {
+            throw std::invalid_argument("RyReflect: unknown field path \"" + prefix + mask.name(0) + "\"");
+        }
+    }
+
+    template <typename T>
+    void readJsonFields(JsonReader& reader, T& value, const FieldMask& mask);
+
+    template <typename T, std::size_t... I>
+    constexpr auto makeMemberFieldReaders(std::index_sequence<I...>)
+    {
+        using Reader = void (*)(JsonReader&, T&, const FieldMask&);
+        return std::array<Reader, sizeof...(I)>{+[](JsonReader& reader, T& obj, const FieldMask& mask) { readJsonFields(reader, std::get<I>(obj.getMemberValues()), mask); }...};
+    }
+
+    template <typename T>
+    inline constexpr auto memberFieldReaders = makeMemberFieldReaders<T>(std::make_index_sequence<memberCount<T>>{});
+
+    // 只解码 mask 选择的成员，其余的值（包括嵌套对象和大数组）只做括号与引号匹配后跳过，不解析其内容。
+    // 选择的成员都读到后，对象剩余的部分直接跳过；因此重复的键只取第一次出现的值，还没有读完时也同样跳过后面重复的键
+    template <typename T>
+    void readJsonFields(JsonReader& reader, T& value, const FieldMask& mask)
+    {
+        if constexpr (ForEachable<T>) {
+            if (mask.all()) {
+                readJson(reader, value);
+                return;
+            }
+            if (reader.consumeNull()) {
+                return;
+            }
+            if (!reader.expect('{', "expected object", JsonErrorCode::TypeMismatch) || !reader.enter()) {
+                return;
+            }
+            if (!reader.consume('}')) {
+                // 已读到的子项，前 64 个用一个整数记录，选择超过 64 个子项时其余的记录在 seenHigh 中
+                std::uint64_t     seenLow = 0;
+                std::vector<bool> seenHigh(mask.size() > 64 ? mask.size() - 64 : 0);
+                std::size_t       pending = mask.size();
+                auto              markSeen = [&](std::size_t field) {
+                    if (field < 64) {
+                        const std::uint64_t bit = std::uint64_t{ 1 } << field;
+                        const bool          seen = (seenLow & bit) != 0;
+                        seenLow |= bit;
+                        return !seen;
+                    }
+                    const bool seen = seenHigh[field - 64];
+                    seenHigh[field - 64] = true;
+                    return !seen;
+                };
+                std::string scratch;
+                bool        done = false;
+                do {
+                    std::string_view key;
+                    if (!reader.readStringView(key, scratch) || !reader.expect(':', "expected ':'")) {
+                        break;
+                    }
+                    const std::size_t field = mask.indexOf(key);
+                    const std::size_t index = field < mask.size() ? findMemberIndex<T>(key) : memberCount<T>;
+                    if (index < memberCount<T> && markSeen(field)) {
+                        memberFieldReaders<T>[index](reader, value, mask.child(field));
+                        if (--pending == 0 && reader.ok()) {
+                            reader.skipObjectRest();
+                            done = true;
+                            break;
+                        }
+                    }
+                    else {
+                        reader.skipValue();
+                    }
+                } while (reader.ok() && reader.consume(','));
+                if (!done) {
+                    reader.expect('}', "expected ',' or '}'");
+                }
+            }
+            reader.leave();
+        }
+        else if constexpr (ProjectableContainer<T>) {
+            if (mask.all()) {
+                readJson(reader, value);
+                return;
+            }
+            if (reader.consumeNull()) {
+                return;
+            }
+            if (!reader.expect('[', "expected array", JsonErrorCode::TypeMismatch) || !reader.enter()) {
+                return;
+            }
+            if constexpr (ReusableContainer<T>) {
+                auto it = value.begin();
+                if (!reader.consume(']')) {
+                    do {
+                        readJsonFields(reader, reuseContainerElement(value, it), mask);
+                    } while (reader.ok() && reader.consume(','));
+                    reader.expect(']', "expected ',' or ']'");
+                }
+                value.erase(it, value.end());
+            }
+            else {
+                value.clear();
+                if (!reader.consume(']')) {
+                    do {
+                        typename T::value_type item{};
+                        readJsonFields(reader, item, mask);
+                        value.insert(value.end(), std::move(item));
+                    } while (reader.ok() && reader.consume(','));
+                    reader.expect(']', "expected ',' or ']'");
+                }
+            }
+            reader.leave();
+        }
+        else {
+            readJson(reader, value);
+        }
+    }
+
+    // 按已检查过的选择部分解码
+    template <typename T>
+    void decodeJsonFields(T& obj, std::string_view text, const FieldMask& mask)
+    {
+        JsonReader reader(text);
+        readJsonFields(reader, obj, mask);
+        if (reader.ok() && !reader.atEnd()) {
+            reader.fail("unexpected trailing characters");
+        }
+        if (!reader.ok()) {
+            throw JsonParseError(reader.errorMessage(), reader.errorOffset());
+        }
+    }
+
+    // 部分解码的原地版本，未选择的成员保留原值；路径不是 T 的成员时抛出 std::invalid_argument
+    template <typename T>
+    void fromJsonInto(T& obj, std::string_view text, const FieldMask& mask)
+    {
+        checkFieldMask<T>(mask, {});
+        decodeJsonFields(obj, text, mask);
+    }
+
+    template <typename T, FixedString... Paths>
+    void fromJsonInto(T& obj, std::string_view text, FieldSelection<Paths...>)
+    {
+        static_assert((isFieldPath<T>(Paths.view()) && ...), "fields<...> contains a path that is not a member");
+        decodeJsonFields(obj, text, FieldSelection<Paths...>::mask());
+    }
+
+    // 部分解码：只填充 mask 选择的成员，其余成员保持默认值，格式错误时抛出 JsonParseError，路径不是 T 的成员时抛出 std::invalid_argument。
+    // 跳过的部分只检查括号与引号是否匹配，不检查其中的语法
+    template <typename T>
+    T fromJsonString(std::string_view text, const FieldMask& mask)
+    {
+        T obj{};
+        fromJsonInto(obj, text, mask);
+        return obj;
+    }
+
+    template <typename T, FixedString... Paths>
+    T fromJsonString(std::string_view text, FieldSelection<Paths...> selection)
+    {
+        T obj{};
+        fromJsonInto(obj, text, selection);
+        return obj;
+    }
+
+    // 不抛出异常的 fromJsonInto：失败时返回错误类别、偏移和出错值的路径，obj 可能已被部分修改
+    template <typename T>
+    std::expected<void, JsonError> tryFromJsonInto(T& obj, std::string_view text)
+    {
+        JsonReader reader(text);
+        readJson(reader, obj);
+        if (reader.ok() && !reader.atEnd()) {
+            reader.fail("unexpected trailing characters");
+        }
+        if (reader.ok()) {
+            return {};
+        }
+        JsonError error{ reader.errorCode(), reader.errorMessage(), reader.errorOffset(), jsonPathAt(text, reader.errorOffset()) };
+        reportDiagnostic(Diagnostic{ DiagnosticKind::ParseError, {}, error.path, error.message });
+        return std::unexpected(std::move(error));
+    }
+
+    // 不抛出异常的 fromJsonString，适合输入不可信、错误很常见的热路径
+    template <typename T>
+    std::expected<T, JsonError> tryFromJson(std::string_view text)
+    {
+        T obj{};
+        if (auto result = tryFromJsonInto(obj, text); !result) {
+            return std::unexpected(std::move(result.error()));
+        }
+        return obj;
+    }
+
+    // RY_REFLECTABLE 生成的 toJson/fromJson 的实现。内联模式下在类内调用；
+    // 定义 RY_REFLECT_OUT_OF_LINE 时类内只有声明，由 RY_REFLECT_IMPL 在单个 .cpp 中调用
+    template <typename T>
+    JsonObject toJsonObject(const T& obj)
+    {
+        JsonObject json;
+        reserveJsonObject(json, memberCount<T>);
+        forEach(obj, [&json](const auto& name, const auto& value) { json[name] = toJsonValue(value); });
+        return json;
+    }
+
+    template <typename T>
+    T fromJsonObject(const JsonObject& json, std::string_view typeName)
+    {
+        T obj;
+        forEach(obj, [&json, typeName](const auto& name, auto& value) {
+            if (!readJsonMember(json, name, value)) {
+                reportDiagnostic(Diagnostic{ DiagnosticKind::MissingKey, typeName, name, "key not found" });
+            }
+        });
+        return obj;
+    }
+
+    // 默认 toJson/fromJson 定义在类内，每个用到它们的翻译单元都会各自实例化整条编解码链。
+    // 在所有翻译单元中一致地定义 RY_REFLECT_OUT_OF_LINE 后，RY_REFLECTABLE 只声明这两个函数：
+    // 头文件中在类定义之后写 RY_REFLECT_DECLARE(Type)，阻止其他翻译单元隐式实例化 toJsonValue、fromJsonValue
+    // 和 std::vector<Type> 的数组辅助函数；某一个 .cpp 中写 RY_REFLECT_IMPL(Type)，定义 toJson/fromJson 并显式实例化它们。
+    // 两个宏都必须写在全局命名空间中，Type 使用完整限定名
+#ifdef RY_REFLECT_OUT_OF_LINE
+#define RYREFLECT_JSON_MEMBERS(TypeName)                                                                                                                                                               \
+    RyReflect::JsonObject toJson() const;                                                                                                                                                              \
+    static TypeName fromJson(const RyReflect::JsonObject& json);
+#define RY_REFLECT_DECLARE(Type)                                                                                                                                                                       \
+    extern template RyReflect::JsonValue RyReflect::toJsonValue<Type>(const Type&);                                                                                                                    \
+    extern template Type RyReflect::fromJsonValue<Type>(const RyReflect::JsonValue&);                                                                                                                  \
+    extern template RyReflect::JsonArray RyReflect::toJsonArray<std::vector<Type>>(const std::vector<Type>&);                                                                                          \
+    extern template std::vector<Type> RyReflect::fromJsonArray<std::vector<Type>>(const RyReflect::JsonArray&);
+#define RY_REFLECT_IMPL(Type)                                                                                                                                                                          \
+    RyReflect::JsonObject Type::toJson() const                                                                                                                                                         \
+    {                                                                                                                                                                                                  \
+        return RyReflect::toJsonObject(*this);                                                                                                                                                         \
+    }                                                                                                                                                                                                  \
+    Type Type::fromJson(const RyReflect::JsonObject& json)                                                                                                                                             \
+    {                                                                                                                                                                                                  \
+        return RyReflect::fromJsonObject<Type>(json, #Type);                                                                                                                                           \
+    }                                                                                                                                                                                                  \
+    template RyReflect::JsonValue RyReflect::toJsonValue<Type>(const Type&);                                                                                                                           \
+    template Type RyReflect::fromJsonValue<Type>(const RyReflect::JsonValue&);                                                                                                                         \
+    template RyReflect::JsonArray RyReflect::toJsonArray<std::vector<Type>>(const std::vector<Type>&);                                                                                                 \
+    template std::vector<Type> RyReflect::fromJsonArray<std::vector<Type>>(const RyReflect::JsonArray&);
+#else
+#define RYREFLECT_JSON_MEMBERS(TypeName)                                                                                                                                                               \
+    RyReflect::JsonObject toJson() const                                                                                                                                                               \
+    {                                                                                                                                                                                                  \
+        return RyReflect::toJsonObject(*this);                                                                                                                                                         \
+    }                                                                                                                                                                                                  \
+    static TypeName fromJson(const RyReflect::JsonObject& json)                                                                                                                                        \
+    {                                                                                                                                                                                                  \
+        return RyReflect::fromJsonObject<TypeName>(json, #TypeName);                                                                                                                                   \
+    }
+#define RY_REFLECT_DECLARE(Type)
+#define RY_REFLECT_IMPL(Type)
+#endif
+
+    // 定义RY_REFLECTABLE宏，用于在结构体中声明反射所需的成员函数
+#define RY_REFLECTABLE(TypeName, ...)                                                                                                                                                                  \
+    using RyReflectSelf = TypeName;                                                                                                                                                                    \
+    auto getMemberValues()                                                                                                                                                                             \
+    {                                                                                                                                                                                                  \
+        return std::tie(__VA_ARGS__);                                                                                                                                                                  \
+    }                                                                                                                                                                                                  \
+    auto getMemberValues() const                                                                                                                                                                       \
+    {                                                                                                                                                                                                  \
+        return std::tie(__VA_ARGS__);                                                                                                                                                                  \
+    }                                                                                                                                                                                                  \
+    constexpr static auto getMemberNames()                                                                                                                                                             \
+    {                                                                                                                                                                                                  \
+        return std::make_tuple(RYREFLECT_FOR_EACH(RYREFLECT_STRINGIZE, __VA_ARGS__));                                                                                                                  \
+    }                                                                                                                                                                                                  \
+    constexpr static auto getMemberPointers()                                                                                                                                                          \
+    {                                                                                                                                                                                                  \
+        return std::make_tuple(RYREFLECT_FOR_EACH(RYREFLECT_MEMBER_POINTER, __VA_ARGS__));                                                                                                             \
+    }                                                                                                                                                                                                  \
+    RYREFLECT_JSON_MEMBERS(TypeName)
+
 } // namespace RyReflect
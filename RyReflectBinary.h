@@ -0,0 +1,377 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description 基于反射的紧凑二进制序列化
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#pragma once
+#include "RyReflect.h"
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <span>
+
+namespace RyReflect
+{
+    // 二进制格式没有自描述的schema，成员顺序即 getMemberValues() 的顺序：
+    // - bool 占一个字节
+    // - 无符号整数为 LEB128 变长编码，有符号整数先做 zigzag 再变长编码
+    // - float/double 为小端定长
+    // - 字符串为长度前缀加 UTF-8 字节
+    // - 容器为元素个数前缀加各元素
+    // - 反射类型依次写出各成员
+    using BinaryBuffer = std::vector<std::byte>;
+
+    inline void writeVarint(BinaryBuffer& out, std::uint64_t value)
+    {
+        while (value >= 0x80) {
+            out.push_back(static_cast<std::byte>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<std::byte>(value));
+    }
+
+    inline void writeBinaryBytes(BinaryBuffer& out, const void* data, std::size_t size)
+    {
+        const auto* bytes = static_cast<const std::byte*>(data);
+        out.insert(out.end(), bytes, bytes + size);
+    }
+
+    // 以小端字节序写入定长的值
+    template <typename T>
+    void writeLittleEndian(BinaryBuffer& out, T value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        std::array<std::byte, sizeof(T)> bytes;
+        std::memcpy(bytes.data(), &value, sizeof(T));
+        if constexpr (std::endian::native == std::endian::big) {
+            for (std::size_t i = 0; i < sizeof(T) / 2; ++i) {
+                std::swap(bytes[i], bytes[sizeof(T) - 1 - i]);
+            }
+        }
+        out.insert(out.end(), bytes.begin(), bytes.end());
+    }
+
+    // 将值追加写入二进制缓冲区，类型分派与 writeJson 保持一致
+    template <typename T>
+    void writeBinary(const T& value, BinaryBuffer& out)
+    {
+        if constexpr (std::is_same_v<T, std::string>) {
+            writeVarint(out, value.size());
+            writeBinaryBytes(out, value.data(), value.size());
+        }
+#ifdef RY_USE_QT
+        else if constexpr (std::is_same_v<T, QString>) {
+            writeBinary(value.toUtf8(), out);
+        }
+        else if constexpr (std::is_same_v<T, QByteArray>) {
+            writeVarint(out, static_cast<std::uint64_t>(value.size()));
+            writeBinaryBytes(out, value.constData(), static_cast<std::size_t>(value.size()));
+        }
+#endif
+        else if constexpr (std::is_same_v<T, bool>) {
+            out.push_back(static_cast<std::byte>(value ? 1 : 0));
+        }
+        else if constexpr (std::is_floating_point_v<T>) {
+            writeLittleEndian(out, value);
+        }
+        else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            const auto wide = static_cast<std::int64_t>(value);
+            writeVarint(out, (static_cast<std::uint64_t>(wide) << 1) ^ static_cast<std::uint64_t>(wide >> 63));
+        }
+        else if constexpr (std::is_integral_v<T>) {
+            writeVarint(out, static_cast<std::uint64_t>(value));
+        }
+        else if constexpr (is_container<T>::value) {
+            writeVarint(out, static_cast<std::uint64_t>(std::distance(value.begin(), value.end())));
+            for (const auto& item : value) {
+                writeBinary(item, out);
+            }
+        }
+        else if constexpr (ForEachable<T>) {
+            forEach(value, [&out](const auto&, const auto& member) { writeBinary(member, out); });
+        }
+        else {
+            static_assert(always_false<T>, "Unsupported type in writeBinary");
+        }
+    }
+
+    // 序列化到调用方持有的缓冲区，复用其已有容量
+    template <typename T>
+    void toBinary(const T& obj, BinaryBuffer& out)
+    {
+        out.clear();
+        writeBinary(obj, out);
+    }
+
+    template <typename T>
+    BinaryBuffer toBinary(const T& obj)
+    {
+        BinaryBuffer out;
+        writeBinary(obj, out);
+        return out;
+    }
+
+    // 二进制数据解码错误，offset 为出错位置的字节偏移
+    class BinaryDecodeError : public std::runtime_error
+    {
+    public:
+        BinaryDecodeError(const std::string& message, std::size_t offset)
+            : std::runtime_error(message + " at offset " + std::to_string(offset))
+            , m_offset(offset)
+        { }
+
+        std::size_t offset() const { return m_offset; }
+
+    private:
+        std::size_t m_offset;
+    };
+
+    // 二进制读取器，与 JsonReader 一样在出错时记录错误并停止前进
+    class BinaryReader
+    {
+    public:
+        explicit BinaryReader(std::span<const std::byte> data)
+            : m_data(data)
+        { }
+
+        bool ok() const { return m_error == nullptr; }
+        const char* errorMessage() const { return m_error; }
+        std::size_t errorOffset() const { return m_errorOffset; }
+        std::size_t offset() const { return m_pos; }
+        std::size_t remaining() const { return m_data.size() - m_pos; }
+
+        // 容器和反射类型的最大嵌套层数，与 JsonReader 相同，避免递归解码深层输入时耗尽栈空间
+        static constexpr std::size_t maxDepth = JsonReader::maxDepth;
+
+        // 进入一层容器或反射类型，超过 maxDepth 时记录错误并返回 false；返回 true 时需要与 leave 成对调用
+        bool enter()
+        {
+            if (m_depth == maxDepth) {
+                fail("data too deep");
+                return false;
+            }
+            ++m_depth;
+            return true;
+        }
+
+        void leave() { --m_depth; }
+
+        // 一次解码中编码为零字节的容器元素（例如没有成员的反射类型）的总数上限。其他元素至少占一个字节，个数受输入长度限制，
+        // 这类元素没有这种限制，伪造的个数会导致长时间循环
+        static constexpr std::uint64_t maxEmptyElements = std::uint64_t{1} << 20;
+
+        // 从零字节元素的额度中扣除 count 个，超出时记录错误并返回 false
+        bool takeEmptyElements(std::uint64_t count)
+        {
+            if (count > m_emptyElements) {
+                fail("too many empty elements");
+                return false;
+            }
+            m_emptyElements -= count;
+            return true;
+        }
+
+        void fail(const char* message)
+        {
+            if (m_error == nullptr) {
+                m_error       = message;
+                m_errorOffset = m_pos;
+            }
+            m_pos = m_data.size();
+        }
+
+        bool readVarint(std::uint64_t& out)
+        {
+            out = 0;
+            for (unsigned shift = 0; shift < 64; shift += 7) {
+                if (m_pos == m_data.size()) {
+                    fail("truncated varint");
+                    return false;
+                }
+                const auto byte = static_cast<std::uint8_t>(m_data[m_pos++]);
+                if (shift == 63 && byte > 1) {
+                    break;
+                }
+                out |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) {
+                    return true;
+                }
+            }
+            fail("varint overflow");
+            return false;
+        }
+
+        // 读取 size 个字节，返回指向输入的视图
+        bool readBytes(std::size_t size, std::span<const std::byte>& out)
+        {
+            if (size > remaining()) {
+                fail("truncated data");
+                return false;
+            }
+            out = m_data.subspan(m_pos, size);
+            m_pos += size;
+            return true;
+        }
+
+        template <typename T>
+        bool readLittleEndian(T& out)
+        {
+            std::span<const std::byte> bytes;
+            if (!readBytes(sizeof(T), bytes)) {
+                return false;
+            }
+            std::array<std::byte, sizeof(T)> buffer;
+            std::memcpy(buffer.data(), bytes.data(), sizeof(T));
+            if constexpr (std::endian::native == std::endian::big) {
+                for (std::size_t i = 0; i < sizeof(T) / 2; ++i) {
+                    std::swap(buffer[i], buffer[sizeof(T) - 1 - i]);
+                }
+            }
+            std::memcpy(&out, buffer.data(), sizeof(T));
+            return true;
+        }
+
+    private:
+        std::span<const std::byte> m_data;
+        std::size_t                m_pos           = 0;
+        const char*                m_error         = nullptr;
+        std::size_t                m_errorOffset   = 0;
+        std::size_t                m_depth         = 0;
+        std::uint64_t              m_emptyElements = maxEmptyElements;
+    };
+
+    template <typename T>
+    constexpr bool binaryMayBeEmpty();
+
+    template <typename T, std::size_t... I>
+    constexpr bool binaryMembersMayBeEmpty(std::index_sequence<I...>)
+    {
+        return (binaryMayBeEmpty<MemberType<T, I>>() && ...);
+    }
+
+    // 编码是否可能为零字节：只有成员全部可能为零字节的反射类型（包括没有成员的类型）才会如此，其他类型至少占一个字节
+    template <typename T>
+    constexpr bool binaryMayBeEmpty()
+    {
+        if constexpr (ForEachable<T> && !is_container<T>::value) {
+            return binaryMembersMayBeEmpty<T>(std::make_index_sequence<memberCount<T>>{});
+        }
+        else {
+            return false;
+        }
+    }
+
+    // 从 reader 读取一个值写入 value
+    template <typename T>
+    void readBinary(BinaryReader& reader, T& value)
+    {
+        if constexpr (std::is_same_v<T, std::string>) {
+            std::uint64_t size = 0;
+            std::span<const std::byte> bytes;
+            if (reader.readVarint(size) && reader.readBytes(static_cast<std::size_t>(size), bytes)) {
+                value.assign(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+            }
+        }
+#ifdef RY_USE_QT
+        else if constexpr (std::is_same_v<T, QString> || std::is_same_v<T, QByteArray>) {
+            std::uint64_t size = 0;
+            std::span<const std::byte> bytes;
+            if (reader.readVarint(size) && reader.readBytes(static_cast<std::size_t>(size), bytes)) {
+                const auto* data = reinterpret_cast<const char*>(bytes.data());
+                if constexpr (std::is_same_v<T, QString>) {
+                    value = QString::fromUtf8(data, static_cast<qsizetype>(bytes.size()));
+                }
+                else {
+                    value = QByteArray(data, static_cast<qsizetype>(bytes.size()));
+                }
+            }
+        }
+#endif
+        else if constexpr (std::is_same_v<T, bool>) {
+            std::span<const std::byte> bytes;
+            if (reader.readBytes(1, bytes)) {
+                value = bytes[0] != std::byte{0};
+            }
+        }
+        else if constexpr (std::is_floating_point_v<T>) {
+            reader.readLittleEndian(value);
+        }
+        else if constexpr (std::is_integral_v<T>) {
+            std::uint64_t raw = 0;
+            if (!reader.readVarint(raw)) {
+                return;
+            }
+            if constexpr (std::is_signed_v<T>) {
+                const auto wide = static_cast<std::int64_t>(raw >> 1) ^ -static_cast<std::int64_t>(raw & 1);
+                if (wide < std::numeric_limits<T>::min() || wide > std::numeric_limits<T>::max()) {
+                    reader.fail("integer out of range");
+                    return;
+                }
+                value = static_cast<T>(wide);
+            }
+            else {
+                if (raw > std::numeric_limits<T>::max()) {
+                    reader.fail("integer out of range");
+                    return;
+                }
+                value = static_cast<T>(raw);
+            }
+        }
+        else if constexpr (is_container<T>::value) {
+            std::uint64_t count = 0;
+            if (!reader.readVarint(count)) {
+                return;
+            }
+            if constexpr (binaryMayBeEmpty<typename T::value_type>()) {
+                if (!reader.takeEmptyElements(count)) {
+                    return;
+                }
+            }
+            else if (count > reader.remaining()) {
+                // 元素至少占一个字节，个数超过剩余字节数时数据必然不完整
+                reader.fail("truncated data");
+                return;
+            }
+            if (!reader.enter()) {
+                return;
+            }
+            value.clear();
+            if constexpr (requires { value.reserve(std::size_t{}); }) {
+                value.reserve(static_cast<std::size_t>(count));
+            }
+            for (std::uint64_t i = 0; i < count && reader.ok(); ++i) {
+                typename T::value_type item{};
+                readBinary(reader, item);
+                value.insert(value.end(), std::move(item));
+            }
+            reader.leave();
+        }
+        else if constexpr (ForEachable<T>) {
+            if (!reader.enter()) {
+                return;
+            }
+            forEach(value, [&reader](const auto&, auto& member) { readBinary(reader, member); });
+            reader.leave();
+        }
+        else {
+            static_assert(always_false<T>, "Unsupported type in readBinary");
+        }
+    }
+
+    // 从二进制数据解码出对象，数据不完整或有多余字节时抛出 BinaryDecodeError
+    template <typename T>
+    T fromBinary(std::span<const std::byte> data)
+    {
+        T obj{};
+        BinaryReader reader(data);
+        readBinary(reader, obj);
+        if (reader.ok() && reader.remaining() != 0) {
+            reader.fail("unexpected trailing bytes");
+        }
+        if (!reader.ok()) {
+            throw BinaryDecodeError(reader.errorMessage(), reader.errorOffset());
+        }
+        return obj;
+    }
+} // namespace RyReflect
@@ -0,0 +1,246 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description 成员级差异：只输出两个对象之间变化的成员，生成 JSON merge-patch 或二进制增量并应用到对象上
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#pragma once
+#include "RyReflect.h"
+#include "RyReflectBinary.h"
+#include <algorithm>
+
+namespace RyReflect
+{
+    // 按序列化的内容比较两个值：反射类型逐个成员比较，容器逐个元素比较，其余类型使用 ==。
+    // 成员和元素不要求提供 operator==
+    template <typename T>
+    bool equalValues(const T& a, const T& b);
+
+    template <typename T, std::size_t... I>
+    bool equalMembers(const T& a, const T& b, std::index_sequence<I...>)
+    {
+        const auto lhs = a.getMemberValues();
+        const auto rhs = b.getMemberValues();
+        return (equalValues(std::get<I>(lhs), std::get<I>(rhs)) && ...);
+    }
+
+    template <typename T>
+    bool equalValues(const T& a, const T& b)
+    {
+        if constexpr (ForEachable<T>) {
+            return equalMembers(a, b, std::make_index_sequence<memberCount<T>>{});
+        }
+        else if constexpr (is_container<T>::value && !std::is_same_v<T, std::string>) {
+            return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const auto& x, const auto& y) { return equalValues(x, y); });
+        }
+        else {
+            return a == b;
+        }
+    }
+
+    template <ForEachable T>
+    JsonObject diff(const T& from, const T& to);
+
+    template <typename T, std::size_t... I>
+    void diffMembers(const T& from, const T& to, JsonObject& patch, std::index_sequence<I...>)
+    {
+        const auto lhs   = from.getMemberValues();
+        const auto rhs   = to.getMemberValues();
+        const auto names = T::getMemberNames();
+        (
+            [&] {
+                using M = MemberType<T, I>;
+                if (equalValues(std::get<I>(lhs), std::get<I>(rhs))) {
+                    return;
+                }
+                // 反射类型的成员递归生成子补丁，容器和其他类型整体替换，与 RFC 7386 对数组的处理一致
+                if constexpr (ForEachable<M>) {
+                    patch[std::get<I>(names)] = diff(std::get<I>(lhs), std::get<I>(rhs));
+                }
+                else {
+                    patch[std::get<I>(names)] = toJsonValue(std::get<I>(rhs));
+                }
+            }(),
+            ...);
+    }
+
+    // 生成把 from 变为 to 的 JSON merge-patch，只包含变化的成员；两者相同时返回空对象。
+    // 反射类型没有可删除的成员，补丁中不会出现 null
+    template <ForEachable T>
+    JsonObject diff(const T& from, const T& to)
+    {
+        JsonObject patch;
+        diffMembers(from, to, patch, std::make_index_sequence<memberCount<T>>{});
+        return patch;
+    }
+
+    template <typename T, JsonSink Sink>
+    void writeJsonPatch(const T& from, const T& to, Sink& sink);
+
+    template <typename T, JsonSink Sink, std::size_t... I>
+    void writeJsonPatchMembers(const T& from, const T& to, Sink& sink, std::index_sequence<I...>)
+    {
+        constexpr auto& fragments = memberKeyFragments<T>;
+        const auto      lhs       = from.getMemberValues();
+        const auto      rhs       = to.getMemberValues();
+        bool            first     = true;
+        (
+            [&] {
+                if (equalValues(std::get<I>(lhs), std::get<I>(rhs))) {
+                    return;
+                }
+                // 片段以 { 或 , 开头，这里按实际写出的第一个成员重新决定分隔符
+                const auto fragment = fragments.fragment(I);
+                sink.push_back(first ? '{' : ',');
+                sink.append(fragment.data() + 1, fragment.size() - 1);
+                first = false;
+                writeJsonPatch(std::get<I>(lhs), std::get<I>(rhs), sink);
+            }(),
+            ...);
+        if (first) {
+            sink.push_back('{');
+        }
+        sink.push_back('}');
+    }
+
+    // 反射类型写出只含变化成员的对象，其他类型写出 to 的完整值
+    template <typename T, JsonSink Sink>
+    void writeJsonPatch(const T& from, const T& to, Sink& sink)
+    {
+        if constexpr (ForEachable<T>) {
+            writeJsonPatchMembers(from, to, sink, std::make_index_sequence<memberCount<T>>{});
+        }
+        else {
+            writeJson(to, sink);
+        }
+    }
+
+    // diff 的文本版本，直接写出紧凑的补丁文本而不构建 JsonObject，复用 out 已有的容量。
+    // 两者相同时写出 {} 并返回 false
+    template <ForEachable T>
+    bool diffJsonString(const T& from, const T& to, std::string& out)
+    {
+        out.clear();
+        writeJsonPatch(from, to, out);
+        return out.size() > 2;
+    }
+
+    template <ForEachable T>
+    std::string diffJsonString(const T& from, const T& to)
+    {
+        std::string out;
+        diffJsonString(from, to, out);
+        return out;
+    }
+
+    // 二进制增量的格式：反射类型依次写出每个变化成员的 varint(下标 + 1) 和成员的值，以 varint 0 结束；
+    // 反射类型的成员递归写出增量，其他成员按 writeBinary 写出 to 的完整值。与 toBinary 一样没有自描述的schema，
+    // 两端的成员顺序必须一致
+    template <typename T>
+    void writeBinaryPatch(const T& from, const T& to, BinaryBuffer& out);
+
+    template <typename T, std::size_t... I>
+    void writeBinaryPatchMembers(const T& from, const T& to, BinaryBuffer& out, std::index_sequence<I...>)
+    {
+        const auto lhs = from.getMemberValues();
+        const auto rhs = to.getMemberValues();
+        (
+            [&] {
+                if (!equalValues(std::get<I>(lhs), std::get<I>(rhs))) {
+                    writeVarint(out, I + 1);
+                    writeBinaryPatch(std::get<I>(lhs), std::get<I>(rhs), out);
+                }
+            }(),
+            ...);
+        writeVarint(out, 0);
+    }
+
+    template <typename T>
+    void writeBinaryPatch(const T& from, const T& to, BinaryBuffer& out)
+    {
+        if constexpr (ForEachable<T>) {
+            writeBinaryPatchMembers(from, to, out, std::make_index_sequence<memberCount<T>>{});
+        }
+        else {
+            writeBinary(to, out);
+        }
+    }
+
+    // 生成把 from 变为 to 的二进制增量，复用 out 已有的容量；两者相同时只写出结束标记并返回 false
+    template <ForEachable T>
+    bool diffBinary(const T& from, const T& to, BinaryBuffer& out)
+    {
+        out.clear();
+        writeBinaryPatch(from, to, out);
+        return out.size() > 1;
+    }
+
+    template <ForEachable T>
+    BinaryBuffer diffBinary(const T& from, const T& to)
+    {
+        BinaryBuffer out;
+        writeBinaryPatch(from, to, out);
+        return out;
+    }
+
+    template <typename T>
+    void readBinaryPatch(BinaryReader& reader, T& value);
+
+    template <typename T, std::size_t... I>
+    constexpr auto makeMemberPatchReaders(std::index_sequence<I...>)
+    {
+        using Reader = void (*)(BinaryReader&, T&);
+        return std::array<Reader, sizeof...(I)>{+[](BinaryReader& reader, T& obj) { readBinaryPatch(reader, std::get<I>(obj.getMemberValues())); }...};
+    }
+
+    // 按成员下标分派的增量读取函数表
+    template <typename T>
+    inline constexpr auto memberPatchReaders = makeMemberPatchReaders<T>(std::make_index_sequence<memberCount<T>>{});
+
+    // 从 reader 读取一段增量应用到 value 上，增量中没有的成员保留原值
+    template <typename T>
+    void readBinaryPatch(BinaryReader& reader, T& value)
+    {
+        if constexpr (ForEachable<T>) {
+            std::uint64_t tag = 0;
+            while (reader.readVarint(tag) && tag != 0) {
+                if (tag > memberCount<T>) {
+                    reader.fail("member index out of range");
+                    return;
+                }
+                memberPatchReaders<T>[static_cast<std::size_t>(tag - 1)](reader, value);
+            }
+        }
+        else {
+            readBinary(reader, value);
+        }
+    }
+
+    // 应用 diff 生成的 merge-patch：反射类型的成员按子补丁合并，其他成员整体替换，补丁中没有的成员和 null 保留原值
+    template <ForEachable T>
+    void applyPatch(T& obj, const JsonObject& patch)
+    {
+        fromJsonInto(obj, patch);
+    }
+
+    // 应用 diffJsonString 生成的补丁文本，语义与 JsonObject 版本相同；格式错误时抛出 JsonParseError，此时 obj 可能已被部分修改
+    template <ForEachable T>
+    void applyPatch(T& obj, std::string_view patch)
+    {
+        fromJsonInto(obj, patch);
+    }
+
+    // 应用 diffBinary 生成的二进制增量；数据不完整或有多余字节时抛出 BinaryDecodeError，此时 obj 可能已被部分修改
+    template <ForEachable T>
+    void applyPatch(T& obj, std::span<const std::byte> patch)
+    {
+        BinaryReader reader(patch);
+        readBinaryPatch(reader, obj);
+        if (reader.ok() && reader.remaining() != 0) {
+            reader.fail("unexpected trailing bytes");
+        }
+        if (!reader.ok()) {
+            throw BinaryDecodeError(reader.errorMessage(), reader.errorOffset());
+        }
+    }
+} // namespace RyReflect
@@ -0,0 +1,640 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description 基于内存池的JSON文档树，节点、键和字符串都分配在文档持有的内存池中，整体释放
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#pragma once
+#include "RyReflect.h"
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <span>
+
+namespace RyReflect
+{
+    class Document;
+    struct JsonMember;
+
+    enum class JsonNodeType : std::uint8_t
+    {
+        Null,
+        Bool,
+        Int,
+        UInt,
+        Double,
+        String,
+        Array,
+        Object,
+    };
+
+    // 文档树的节点。节点只保存指向 Document 内存池的指针，可平凡复制和析构，
+    // 因此释放整棵树不需要逐个节点析构，节点的生命周期不能超过所属的 Document
+    class JsonNode
+    {
+    public:
+        JsonNode() = default;
+        JsonNode(std::nullptr_t) { }
+
+        // 整数统一保存为 int64，只有超出 int64 的无符号整数保存为 uint64
+        template <typename T>
+            requires std::is_arithmetic_v<T>
+        explicit JsonNode(T value)
+        {
+            if constexpr (std::is_same_v<T, bool>) {
+                m_type = JsonNodeType::Bool;
+                m_bool = value;
+            }
+            else if constexpr (std::is_floating_point_v<T>) {
+                m_type   = JsonNodeType::Double;
+                m_double = static_cast<double>(value);
+            }
+            else if (std::in_range<std::int64_t>(value)) {
+                m_type = JsonNodeType::Int;
+                m_int  = static_cast<std::int64_t>(value);
+            }
+            else {
+                m_type = JsonNodeType::UInt;
+                m_uint = static_cast<std::uint64_t>(value);
+            }
+        }
+
+        JsonNodeType type() const { return m_type; }
+        bool isNull() const { return m_type == JsonNodeType::Null; }
+        bool isBool() const { return m_type == JsonNodeType::Bool; }
+        bool isNumber() const { return m_type == JsonNodeType::Int || m_type == JsonNodeType::UInt || m_type == JsonNodeType::Double; }
+        bool isString() const { return m_type == JsonNodeType::String; }
+        bool isArray() const { return m_type == JsonNodeType::Array; }
+        bool isObject() const { return m_type == JsonNodeType::Object; }
+
+        bool toBool() const
+        {
+            check(JsonNodeType::Bool, "RyReflect: JSON node is not a boolean");
+            return m_bool;
+        }
+
+        std::string_view toString() const
+        {
+            check(JsonNodeType::String, "RyReflect: JSON node is not a string");
+            return std::string_view(m_string, m_size);
+        }
+
+        // 转换为算术类型 T，无法精确表示时抛出 std::out_of_range
+        template <typename T>
+        T toNumber() const
+        {
+            switch (m_type) {
+            case JsonNodeType::Int: return castInteger<T>(m_int);
+            case JsonNodeType::UInt: return castInteger<T>(m_uint);
+            case JsonNodeType::Double:
+                if constexpr (std::is_floating_point_v<T>) {
+                    return static_cast<T>(m_double);
+                }
+                else {
+                    if (fitsInteger<T>(m_double)) {
+                        return static_cast<T>(m_double);
+                    }
+                    throw std::out_of_range("RyReflect: JSON number out of range");
+                }
+            default: throw std::invalid_argument("RyReflect: JSON node is not a number");
+            }
+        }
+
+        // 数组的元素个数或对象的成员个数
+        std::size_t size() const { return isArray() || isObject() ? m_size : 0; }
+
+        std::span<const JsonNode> items() const
+        {
+            check(JsonNodeType::Array, "RyReflect: JSON node is not an array");
+            return std::span<const JsonNode>(m_items, m_size);
+        }
+
+        std::span<const JsonMember> members() const;
+
+        const JsonNode& operator[](std::size_t index) const { return items()[index]; }
+
+        // 按键查找成员，键重复时返回最后一个，与 JsonObject 的覆盖语义一致；不存在时返回 nullptr
+        const JsonNode* find(std::string_view key) const;
+
+        bool contains(std::string_view key) const { return find(key) != nullptr; }
+
+    private:
+        friend class Document;
+
+        void check(JsonNodeType type, const char* message) const
+        {
+            if (m_type != type) {
+                throw std::invalid_argument(message);
+            }
+        }
+
+        template <typename T, typename I>
+        static T castInteger(I value)
+        {
+            if constexpr (std::is_floating_point_v<T>) {
+                return static_cast<T>(value);
+            }
+            else {
+                if (std::in_range<T>(value)) {
+                    return static_cast<T>(value);
+                }
+                throw std::out_of_range("RyReflect: JSON number out of range");
+            }
+        }
+
+        JsonNodeType  m_type     = JsonNodeType::Null;
+        std::uint32_t m_size     = 0;
+        std::uint32_t m_capacity = 0;
+        union
+        {
+            bool          m_bool;
+            std::int64_t  m_int = 0;
+            std::uint64_t m_uint;
+            double        m_double;
+            const char*   m_string;
+            JsonNode*     m_items;
+            JsonMember*   m_members;
+        };
+    };
+
+    struct JsonMember
+    {
+        std::string_view key;
+        JsonNode         value;
+    };
+
+    static_assert(std::is_trivially_copyable_v<JsonNode> && std::is_trivially_destructible_v<JsonNode>);
+    static_assert(std::is_trivially_copyable_v<JsonMember> && std::is_trivially_destructible_v<JsonMember>);
+
+    inline std::span<const JsonMember> JsonNode::members() const
+    {
+        check(JsonNodeType::Object, "RyReflect: JSON node is not an object");
+        return std::span<const JsonMember>(m_members, m_size);
+    }
+
+    inline const JsonNode* JsonNode::find(std::string_view key) const
+    {
+        const auto all = members();
+        for (auto it = all.rbegin(); it != all.rend(); ++it) {
+            if (it->key == key) {
+                return &it->value;
+            }
+        }
+        return nullptr;
+    }
+
+    // 持有内存池和根节点的JSON文档。所有节点、键和字符串都从单调内存池中分配，
+    // 析构或 clear() 时按内存块整体归还，与树的节点数量无关
+    class Document
+    {
+    public:
+        static constexpr std::size_t maxDepth = 1024;
+
+        Document()
+            : m_resource(std::make_unique<std::pmr::monotonic_buffer_resource>())
+        { }
+
+        // initialSize 为第一块内存的大小，已知文档规模时可以减少分配次数
+        explicit Document(std::size_t initialSize)
+            : m_resource(std::make_unique<std::pmr::monotonic_buffer_resource>(initialSize))
+        { }
+
+        JsonNode& root() { return m_root; }
+        const JsonNode& root() const { return m_root; }
+
+        // 释放所有节点，内存池回到初始状态，之后可以继续复用
+        void clear()
+        {
+            m_resource->release();
+            m_root = JsonNode();
+        }
+
+        // 在内存池中复制字符串
+        JsonNode makeString(std::string_view str)
+        {
+            JsonNode node;
+            node.m_type   = JsonNodeType::String;
+            node.m_size   = checkedSize(str.size());
+            node.m_string = copyString(str);
+            return node;
+        }
+
+        JsonNode makeArray(std::size_t reserve = 0)
+        {
+            JsonNode node;
+            node.m_type     = JsonNodeType::Array;
+            node.m_capacity = checkedSize(reserve);
+            node.m_items    = reserve == 0 ? nullptr : allocate<JsonNode>(reserve);
+            return node;
+        }
+
+        JsonNode makeObject(std::size_t reserve = 0)
+        {
+            JsonNode node;
+            node.m_type     = JsonNodeType::Object;
+            node.m_capacity = checkedSize(reserve);
+            node.m_members  = reserve == 0 ? nullptr : allocate<JsonMember>(reserve);
+            return node;
+        }
+
+        void append(JsonNode& array, const JsonNode& value)
+        {
+            array.check(JsonNodeType::Array, "RyReflect: JSON node is not an array");
+            if (array.m_size == array.m_capacity) {
+                array.m_items = grow(array.m_items, array.m_size, array.m_capacity);
+            }
+            array.m_items[array.m_size++] = value;
+        }
+
+        // 追加一个成员，key 会被复制到内存池中；不检查重复的键
+        void insert(JsonNode& object, std::string_view key, const JsonNode& value) { insertLiteral(object, std::string_view(copyString(key), key.size()), value); }
+
+        // 与 insert 相同，但不复制 key，调用方需保证 key 的生命周期不短于文档（如字符串字面量）
+        void insertLiteral(JsonNode& object, std::string_view key, const JsonNode& value)
+        {
+            object.check(JsonNodeType::Object, "RyReflect: JSON node is not an object");
+            if (object.m_size == object.m_capacity) {
+                object.m_members = grow(object.m_members, object.m_size, object.m_capacity);
+            }
+            object.m_members[object.m_size++] = JsonMember{ key, value };
+        }
+
+        // 解析JSON文本并替换当前内容，格式错误时抛出 JsonParseError
+        void parse(std::string_view text)
+        {
+            clear();
+            JsonReader reader(text);
+            m_root = parseValue(reader, 0);
+            if (reader.ok() && !reader.atEnd()) {
+                reader.fail("unexpected trailing characters");
+            }
+            m_nodeStack.clear();
+            m_memberStack.clear();
+            if (!reader.ok()) {
+                m_root = JsonNode();
+                throw JsonParseError(reader.errorMessage(), reader.errorOffset());
+            }
+        }
+
+    private:
+        static std::uint32_t checkedSize(std::size_t size)
+        {
+            if (size > std::numeric_limits<std::uint32_t>::max()) {
+                throw std::length_error("RyReflect: JSON node too large");
+            }
+            return static_cast<std::uint32_t>(size);
+        }
+
+        template <typename T>
+        T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(m_resource->allocate(count * sizeof(T), alignof(T)));
+        }
+
+        const char* copyString(std::string_view str)
+        {
+            if (str.empty()) {
+                return "";
+            }
+            char* data = allocate<char>(str.size());
+            std::memcpy(data, str.data(), str.size());
+            return data;
+        }
+
+        // 容量翻倍，旧的内存块留在内存池中随文档一起释放
+        template <typename T>
+        T* grow(T* data, std::uint32_t size, std::uint32_t& capacity)
+        {
+            const std::size_t newCapacity = std::max<std::size_t>(4, std::size_t(capacity) * 2);
+            capacity                      = checkedSize(newCapacity);
+            T* newData                    = allocate<T>(newCapacity);
+            if (size != 0) {
+                std::memcpy(newData, data, size * sizeof(T));
+            }
+            return newData;
+        }
+
+        // 子节点先暂存在复用的栈上，容器结束时按确切大小一次性复制进内存池
+        JsonNode parseValue(JsonReader& reader, std::size_t depth)
+        {
+            if (depth > maxDepth) {
+                reader.fail("document too deep", JsonErrorCode::TooDeep);
+                return JsonNode();
+            }
+            switch (reader.peek()) {
+            case '{': {
+                reader.consume('{');
+                const std::size_t base = m_memberStack.size();
+                if (!reader.consume('}')) {
+                    do {
+                        std::string_view key;
+                        if (!reader.readStringView(key, m_scratch) || !reader.expect(':', "expected ':'")) {
+                            return JsonNode();
+                        }
+                        key             = std::string_view(copyString(key), key.size());
+                        JsonNode member = parseValue(reader, depth + 1);
+                        m_memberStack.push_back(JsonMember{ key, member });
+                    } while (reader.ok() && reader.consume(','));
+                    reader.expect('}', "expected ',' or '}'");
+                }
+                JsonNode object = makeObject(m_memberStack.size() - base);
+                object.m_size   = object.m_capacity;
+                if (object.m_size != 0) {
+                    std::memcpy(object.m_members, m_memberStack.data() + base, object.m_size * sizeof(JsonMember));
+                }
+                m_memberStack.resize(base);
+                return object;
+            }
+            case '[': {
+                reader.consume('[');
+                const std::size_t base = m_nodeStack.size();
+                if (!reader.consume(']')) {
+                    do {
+                        JsonNode item = parseValue(reader, depth + 1);
+                        m_nodeStack.push_back(item);
+                    } while (reader.ok() && reader.consume(','));
+                    reader.expect(']', "expected ',' or ']'");
+                }
+                JsonNode array = makeArray(m_nodeStack.size() - base);
+                array.m_size   = array.m_capacity;
+                if (array.m_size != 0) {
+                    std::memcpy(array.m_items, m_nodeStack.data() + base, array.m_size * sizeof(JsonNode));
+                }
+                m_nodeStack.resize(base);
+                return array;
+            }
+            case '"': {
+                std::string_view str;
+                if (!reader.readStringView(str, m_scratch)) {
+                    return JsonNode();
+                }
+                return makeString(str);
+            }
+            case 't':
+            case 'f': {
+                bool flag = false;
+                reader.readBool(flag);
+                return JsonNode(flag);
+            }
+            case 'n':
+                if (!reader.consumeNull()) {
+                    reader.fail("invalid literal");
+                }
+                return JsonNode();
+            case '\0': reader.fail("unexpected end of input", JsonErrorCode::UnexpectedEnd); return JsonNode();
+            default: return parseNumber(reader);
+            }
+        }
+
+        // 整数按 int64 -> uint64 依次尝试，超出64位范围才退化为 double
+        static JsonNode parseNumber(JsonReader& reader)
+        {
+            const std::size_t start = reader.offset();
+            std::string_view token;
+            if (!reader.readNumberToken(token)) {
+                return JsonNode();
+            }
+            if (token.front() != '+' && token.find_first_of(".eE") == std::string_view::npos) {
+                const auto last      = token.data() + token.size();
+                std::int64_t integer = 0;
+                if (const auto result = std::from_chars(token.data(), last, integer); result.ec == std::errc() && result.ptr == last) {
+                    return JsonNode(integer);
+                }
+                std::uint64_t unsignedInteger = 0;
+                if (const auto result = std::from_chars(token.data(), last, unsignedInteger); result.ec == std::errc() && result.ptr == last) {
+                    return JsonNode(unsignedInteger);
+                }
+            }
+            double number = 0;
+            reader.seek(start);
+            reader.readNumber(number);
+            return JsonNode(number);
+        }
+
+        std::unique_ptr<std::pmr::monotonic_buffer_resource> m_resource;
+        JsonNode                                             m_root;
+        std::vector<JsonNode>                                m_nodeStack;
+        std::vector<JsonMember>                              m_memberStack;
+        std::string                                          m_scratch;
+    };
+
+    template <ForEachable T>
+    JsonNode toJson(const T& obj, Document& doc);
+
+    template <typename Container>
+    JsonNode toJsonArray(const Container& container, Document& doc);
+
+    // 将值转换为 doc 中的节点，类型分派与 toJsonValue 保持一致
+    template <typename T>
+    JsonNode toJsonValue(const T& value, Document& doc)
+    {
+        if constexpr (std::is_same_v<T, std::string>) {
+            return doc.makeString(value);
+        }
+#ifdef RY_USE_QT
+        else if constexpr (std::is_same_v<T, QString>) {
+            const QByteArray utf8 = value.toUtf8();
+            return doc.makeString(std::string_view(utf8.constData(), static_cast<std::size_t>(utf8.size())));
+        }
+        else if constexpr (std::is_same_v<T, QByteArray>) {
+            return doc.makeString(std::string_view(value.constData(), static_cast<std::size_t>(value.size())));
+        }
+#endif
+        else if constexpr (std::is_same_v<T, const char*>) {
+            return doc.makeString(value);
+        }
+        else if constexpr (std::is_arithmetic_v<T>) {
+            return JsonNode(value);
+        }
+        else if constexpr (is_container<T>::value) {
+            return toJsonArray(value, doc);
+        }
+        else if constexpr (ForEachable<T>) {
+            return toJson(value, doc);
+        }
+        else {
+            static_assert(always_false<T>, "Unsupported type in toJsonValue");
+        }
+    }
+
+    template <typename T, std::size_t... I>
+    void insertJsonMembers(const T& obj, JsonNode& object, Document& doc, std::index_sequence<I...>)
+    {
+        constexpr auto names = memberNameArray<T>();
+        const auto values    = obj.getMemberValues();
+        // 成员名是字符串字面量，不需要复制进内存池
+        (doc.insertLiteral(object, names[I], toJsonValue(std::get<I>(values), doc)), ...);
+    }
+
+    // 将反射对象转换为 doc 中的对象节点
+    template <ForEachable T>
+    JsonNode toJson(const T& obj, Document& doc)
+    {
+        JsonNode object = doc.makeObject(memberCount<T>);
+        insertJsonMembers(obj, object, doc, std::make_index_sequence<memberCount<T>>{});
+        return object;
+    }
+
+    template <typename Container>
+    JsonNode toJsonArray(const Container& container, Document& doc)
+    {
+        JsonNode array;
+        if constexpr (requires { container.size(); }) {
+            array = doc.makeArray(container.size());
+        }
+        else {
+            array = doc.makeArray();
+        }
+        for (const auto& item : container) {
+            doc.append(array, toJsonValue(item, doc));
+        }
+        return array;
+    }
+
+    template <typename T>
+    void readJsonNode(const JsonNode& node, T& value);
+
+    template <typename T, std::size_t... I>
+    constexpr auto makeMemberNodeReaders(std::index_sequence<I...>)
+    {
+        using Reader = void (*)(const JsonNode&, T&);
+        return std::array<Reader, sizeof...(I)>{+[](const JsonNode& node, T& obj) { readJsonNode(node, std::get<I>(obj.getMemberValues())); }...};
+    }
+
+    template <typename T>
+    inline constexpr auto memberNodeReaders = makeMemberNodeReaders<T>(std::make_index_sequence<memberCount<T>>{});
+
+    // 从节点读取值写入 value，null 和缺失的成员保留 value 原有的值
+    template <typename T>
+    void readJsonNode(const JsonNode& node, T& value)
+    {
+        if (node.isNull()) {
+            return;
+        }
+        if constexpr (std::is_same_v<T, std::string>) {
+            value.assign(node.toString());
+        }
+#ifdef RY_USE_QT
+        else if constexpr (std::is_same_v<T, QString>) {
+            const auto str = node.toString();
+            value          = QString::fromUtf8(str.data(), static_cast<qsizetype>(str.size()));
+        }
+        else if constexpr (std::is_same_v<T, QByteArray>) {
+            const auto str = node.toString();
+            value          = QByteArray(str.data(), static_cast<qsizetype>(str.size()));
+        }
+#endif
+        else if constexpr (std::is_same_v<T, bool>) {
+            value = node.toBool();
+        }
+        else if constexpr (std::is_arithmetic_v<T>) {
+            value = node.toNumber<T>();
+        }
+        else if constexpr (ForEachable<T>) {
+            for (const auto& member : node.members()) {
+                const std::size_t index = findMemberIndex<T>(member.key);
+                if (index < memberCount<T>) {
+                    memberNodeReaders<T>[index](member.value, value);
+                }
+            }
+        }
+        else if constexpr (is_container<T>::value) {
+            const auto items = node.items();
+            if constexpr (requires { value.reserve(items.size()); }) {
+                value.reserve(items.size());
+            }
+            if constexpr (ReusableContainer<T>) {
+                auto it = value.begin();
+                for (const auto& itemNode : items) {
+                    readJsonNode(itemNode, reuseContainerElement(value, it));
+                }
+                value.erase(it, value.end());
+            }
+            else {
+                value.clear();
+                for (const auto& itemNode : items) {
+                    typename T::value_type item{};
+                    readJsonNode(itemNode, item);
+                    value.insert(value.end(), std::move(item));
+                }
+            }
+        }
+        else {
+            static_assert(always_false<T>, "Unsupported type in readJsonNode");
+        }
+    }
+
+    template <typename T>
+    T fromJsonValue(const JsonNode& node)
+    {
+        T value{};
+        readJsonNode(node, value);
+        return value;
+    }
+
+    // 从对象节点构建反射对象，类型不匹配时抛出 std::invalid_argument，数值越界时抛出 std::out_of_range
+    template <ForEachable T>
+    T fromJson(const JsonNode& object)
+    {
+        T obj{};
+        readJsonNode(object, obj);
+        return obj;
+    }
+
+    // 原地版本：覆盖 obj 的成员，字符串和容器复用已有的容量与元素，节点中没有的成员保留原值
+    template <typename T>
+    void fromJsonInto(T& obj, const JsonNode& node)
+    {
+        readJsonNode(node, obj);
+    }
+
+    template <typename Container>
+    Container fromJsonArray(const JsonNode& array)
+    {
+        Container container;
+        readJsonNode(array, container);
+        return container;
+    }
+
+    // 将节点写为紧凑的JSON文本，使 toJsonString(doc.root()) 可以直接使用
+    template <JsonSink Sink>
+    void writeJson(const JsonNode& node, Sink& sink)
+    {
+        switch (node.type()) {
+        case JsonNodeType::Null: sink.append("null", 4); break;
+        case JsonNodeType::Bool: writeJson(node.toBool(), sink); break;
+        case JsonNodeType::Int: writeJsonNumber(sink, node.toNumber<std::int64_t>()); break;
+        case JsonNodeType::UInt: writeJsonNumber(sink, node.toNumber<std::uint64_t>()); break;
+        case JsonNodeType::Double: writeJsonNumber(sink, node.toNumber<double>()); break;
+        case JsonNodeType::String: writeJsonString(sink, node.toString()); break;
+        case JsonNodeType::Array: {
+            sink.push_back('[');
+            bool first = true;
+            for (const auto& item : node.items()) {
+                if (!first) {
+                    sink.push_back(',');
+                }
+                first = false;
+                writeJson(item, sink);
+            }
+            sink.push_back(']');
+            break;
+        }
+        case JsonNodeType::Object: {
+            sink.push_back('{');
+            bool first = true;
+            for (const auto& member : node.members()) {
+                if (!first) {
+                    sink.push_back(',');
+                }
+                first = false;
+                writeJsonString(sink, member.key);
+                sink.push_back(':');
+                writeJson(member.value, sink);
+            }
+            sink.push_back('}');
+            break;
+        }
+        }
+    }
+} // namespace RyReflect
@@ -0,0 +1,100 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description RYREFLECT_FOR_EACH：基于 __VA_OPT__ 的变参宏展开，取代原先由 generate.cpp 生成的宏
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#pragma once
+
+// MSVC 的传统预处理器不支持 __VA_OPT__，需要 /Zc:preprocessor
+#if defined(_MSC_VER) && !defined(__clang__) && (!defined(_MSVC_TRADITIONAL) || _MSVC_TRADITIONAL)
+#error "RyReflect requires the conforming preprocessor, compile with /Zc:preprocessor"
+#endif
+
+// 对每个参数调用 action(x)，结果以逗号分隔。剩余参数不超过 32 个时，按个数直接选中 RYREFLECT_FOR_EACH_N 一次展开；
+// 否则直接展开前 32 个，剩余参数交给下一级。判断只看第 33 个参数是否为空，每一级只需扫描一遍剩余参数。
+// 宏不能在自己的展开中再次展开，所以每一级用不同的名字，各级除编号外完全相同。预处理器无法做到不限个数，
+// 最多支持 512 个成员，超出时留下一个未定义的标识符使编译失败；需要更多时照样增加一级
+#define RYREFLECT_FOR_EACH(action, ...) __VA_OPT__(RYREFLECT_FOR_EACH_LEVEL_0(action, __VA_ARGS__))
+#define RYREFLECT_FOR_EACH_ARG(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, x, ...) x
+#define RYREFLECT_FOR_EACH_DIRECT(action, ...) RYREFLECT_FOR_EACH_ARG(__VA_ARGS__, RYREFLECT_FOR_EACH_32, RYREFLECT_FOR_EACH_31, RYREFLECT_FOR_EACH_30, RYREFLECT_FOR_EACH_29, RYREFLECT_FOR_EACH_28, RYREFLECT_FOR_EACH_27, RYREFLECT_FOR_EACH_26, RYREFLECT_FOR_EACH_25, RYREFLECT_FOR_EACH_24, RYREFLECT_FOR_EACH_23, RYREFLECT_FOR_EACH_22, RYREFLECT_FOR_EACH_21, RYREFLECT_FOR_EACH_20, RYREFLECT_FOR_EACH_19, RYREFLECT_FOR_EACH_18, RYREFLECT_FOR_EACH_17, RYREFLECT_FOR_EACH_16, RYREFLECT_FOR_EACH_15, RYREFLECT_FOR_EACH_14, RYREFLECT_FOR_EACH_13, RYREFLECT_FOR_EACH_12, RYREFLECT_FOR_EACH_11, RYREFLECT_FOR_EACH_10, RYREFLECT_FOR_EACH_9, RYREFLECT_FOR_EACH_8, RYREFLECT_FOR_EACH_7, RYREFLECT_FOR_EACH_6, RYREFLECT_FOR_EACH_5, RYREFLECT_FOR_EACH_4, RYREFLECT_FOR_EACH_3, RYREFLECT_FOR_EACH_2, RYREFLECT_FOR_EACH_1)(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_LEVEL_0(action, ...) RYREFLECT_FOR_EACH_PICK_0(RYREFLECT_FOR_EACH_ARG(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,))(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_PICK_0(...) RYREFLECT_FOR_EACH_DIRECT ## __VA_OPT__(_BLOCK_0)
+#define RYREFLECT_FOR_EACH_DIRECT_BLOCK_0(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, ...) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30), action(x31), RYREFLECT_FOR_EACH_LEVEL_1(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_LEVEL_1(action, ...) RYREFLECT_FOR_EACH_PICK_1(RYREFLECT_FOR_EACH_ARG(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,))(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_PICK_1(...) RYREFLECT_FOR_EACH_DIRECT ## __VA_OPT__(_BLOCK_1)
+#define RYREFLECT_FOR_EACH_DIRECT_BLOCK_1(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, ...) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30), action(x31), RYREFLECT_FOR_EACH_LEVEL_2(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_LEVEL_2(action, ...) RYREFLECT_FOR_EACH_PICK_2(RYREFLECT_FOR_EACH_ARG(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,))(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_PICK_2(...) RYREFLECT_FOR_EACH_DIRECT ## __VA_OPT__(_BLOCK_2)
+#define RYREFLECT_FOR_EACH_DIRECT_BLOCK_2(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, ...) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30), action(x31), RYREFLECT_FOR_EACH_LEVEL_3(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_LEVEL_3(action, ...) RYREFLECT_FOR_EACH_PICK_3(RYREFLECT_FOR_EACH_ARG(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,))(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_PICK_3(...) RYREFLECT_FOR_EACH_DIRECT ## __VA_OPT__(_BLOCK_3)
+#define RYREFLECT_FOR_EACH_DIRECT_BLOCK_3(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, ...) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30), action(x31), RYREFLECT_FOR_EACH_LEVEL_4(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_LEVEL_4(action, ...) RYREFLECT_FOR_EACH_PICK_4(RYREFLECT_FOR_EACH_ARG(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,))(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_PICK_4(...) RYREFLECT_FOR_EACH_DIRECT ## __VA_OPT__(_BLOCK_4)
+#define RYREFLECT_FOR_EACH_DIRECT_BLOCK_4(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, ...) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30), action(x31), RYREFLECT_FOR_EACH_LEVEL_5(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_LEVEL_5(action, ...) RYREFLECT_FOR_EACH_PICK_5(RYREFLECT_FOR_EACH_ARG(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,))(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_PICK_5(...) RYREFLECT_FOR_EACH_DIRECT ## __VA_OPT__(_BLOCK_5)
+#define RYREFLECT_FOR_EACH_DIRECT_BLOCK_5(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, ...) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30), action(x31), RYREFLECT_FOR_EACH_LEVEL_6(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_LEVEL_6(action, ...) RYREFLECT_FOR_EACH_PICK_6(RYREFLECT_FOR_EACH_ARG(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,))(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_PICK_6(...) RYREFLECT_FOR_EACH_DIRECT ## __VA_OPT__(_BLOCK_6)
+#define RYREFLECT_FOR_EACH_DIRECT_BLOCK_6(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, ...) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30), action(x31), RYREFLECT_FOR_EACH_LEVEL_7(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_LEVEL_7(action, ...) RYREFLECT_FOR_EACH_PICK_7(RYREFLECT_FOR_EACH_ARG(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,))(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_PICK_7(...) RYREFLECT_FOR_EACH_DIRECT ## __VA_OPT__(_BLOCK_7)
+#define RYREFLECT_FOR_EACH_DIRECT_BLOCK_7(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, ...) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30), action(x31), RYREFLECT_FOR_EACH_LEVEL_8(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_LEVEL_8(action, ...) RYREFLECT_FOR_EACH_PICK_8(RYREFLECT_FOR_EACH_ARG(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,))(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_PICK_8(...) RYREFLECT_FOR_EACH_DIRECT ## __VA_OPT__(_BLOCK_8)
+#define RYREFLECT_FOR_EACH_DIRECT_BLOCK_8(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, ...) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30), action(x31), RYREFLECT_FOR_EACH_LEVEL_9(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_LEVEL_9(action, ...) RYREFLECT_FOR_EACH_PICK_9(RYREFLECT_FOR_EACH_ARG(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,))(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_PICK_9(...) RYREFLECT_FOR_EACH_DIRECT ## __VA_OPT__(_BLOCK_9)
+#define RYREFLECT_FOR_EACH_DIRECT_BLOCK_9(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, ...) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30), action(x31), RYREFLECT_FOR_EACH_LEVEL_10(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_LEVEL_10(action, ...) RYREFLECT_FOR_EACH_PICK_10(RYREFLECT_FOR_EACH_ARG(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,))(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_PICK_10(...) RYREFLECT_FOR_EACH_DIRECT ## __VA_OPT__(_BLOCK_10)
+#define RYREFLECT_FOR_EACH_DIRECT_BLOCK_10(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, ...) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30), action(x31), RYREFLECT_FOR_EACH_LEVEL_11(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_LEVEL_11(action, ...) RYREFLECT_FOR_EACH_PICK_11(RYREFLECT_FOR_EACH_ARG(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,))(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_PICK_11(...) RYREFLECT_FOR_EACH_DIRECT ## __VA_OPT__(_BLOCK_11)
+#define RYREFLECT_FOR_EACH_DIRECT_BLOCK_11(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, ...) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30), action(x31), RYREFLECT_FOR_EACH_LEVEL_12(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_LEVEL_12(action, ...) RYREFLECT_FOR_EACH_PICK_12(RYREFLECT_FOR_EACH_ARG(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,))(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_PICK_12(...) RYREFLECT_FOR_EACH_DIRECT ## __VA_OPT__(_BLOCK_12)
+#define RYREFLECT_FOR_EACH_DIRECT_BLOCK_12(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, ...) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30), action(x31), RYREFLECT_FOR_EACH_LEVEL_13(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_LEVEL_13(action, ...) RYREFLECT_FOR_EACH_PICK_13(RYREFLECT_FOR_EACH_ARG(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,))(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_PICK_13(...) RYREFLECT_FOR_EACH_DIRECT ## __VA_OPT__(_BLOCK_13)
+#define RYREFLECT_FOR_EACH_DIRECT_BLOCK_13(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, ...) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30), action(x31), RYREFLECT_FOR_EACH_LEVEL_14(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_LEVEL_14(action, ...) RYREFLECT_FOR_EACH_PICK_14(RYREFLECT_FOR_EACH_ARG(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,))(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_PICK_14(...) RYREFLECT_FOR_EACH_DIRECT ## __VA_OPT__(_BLOCK_14)
+#define RYREFLECT_FOR_EACH_DIRECT_BLOCK_14(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, ...) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30), action(x31), RYREFLECT_FOR_EACH_LEVEL_15(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_LEVEL_15(action, ...) RYREFLECT_FOR_EACH_PICK_15(RYREFLECT_FOR_EACH_ARG(__VA_ARGS__,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,))(action, __VA_ARGS__)
+#define RYREFLECT_FOR_EACH_PICK_15(...) RYREFLECT_FOR_EACH_DIRECT ## __VA_OPT__(_BLOCK_15)
+#define RYREFLECT_FOR_EACH_DIRECT_BLOCK_15(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31, ...) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30), action(x31) RYREFLECT_ERROR_TOO_MANY_MEMBERS_MAX_512
+#define RYREFLECT_FOR_EACH_1(action, x0) action(x0)
+#define RYREFLECT_FOR_EACH_2(action, x0, x1) action(x0), action(x1)
+#define RYREFLECT_FOR_EACH_3(action, x0, x1, x2) action(x0), action(x1), action(x2)
+#define RYREFLECT_FOR_EACH_4(action, x0, x1, x2, x3) action(x0), action(x1), action(x2), action(x3)
+#define RYREFLECT_FOR_EACH_5(action, x0, x1, x2, x3, x4) action(x0), action(x1), action(x2), action(x3), action(x4)
+#define RYREFLECT_FOR_EACH_6(action, x0, x1, x2, x3, x4, x5) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5)
+#define RYREFLECT_FOR_EACH_7(action, x0, x1, x2, x3, x4, x5, x6) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6)
+#define RYREFLECT_FOR_EACH_8(action, x0, x1, x2, x3, x4, x5, x6, x7) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7)
+#define RYREFLECT_FOR_EACH_9(action, x0, x1, x2, x3, x4, x5, x6, x7, x8) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8)
+#define RYREFLECT_FOR_EACH_10(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9)
+#define RYREFLECT_FOR_EACH_11(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10)
+#define RYREFLECT_FOR_EACH_12(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11)
+#define RYREFLECT_FOR_EACH_13(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12)
+#define RYREFLECT_FOR_EACH_14(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13)
+#define RYREFLECT_FOR_EACH_15(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14)
+#define RYREFLECT_FOR_EACH_16(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15)
+#define RYREFLECT_FOR_EACH_17(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16)
+#define RYREFLECT_FOR_EACH_18(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17)
+#define RYREFLECT_FOR_EACH_19(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18)
+#define RYREFLECT_FOR_EACH_20(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19)
+#define RYREFLECT_FOR_EACH_21(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20)
+#define RYREFLECT_FOR_EACH_22(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21)
+#define RYREFLECT_FOR_EACH_23(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22)
+#define RYREFLECT_FOR_EACH_24(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23)
+#define RYREFLECT_FOR_EACH_25(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24)
+#define RYREFLECT_FOR_EACH_26(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25)
+#define RYREFLECT_FOR_EACH_27(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26)
+#define RYREFLECT_FOR_EACH_28(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27)
+#define RYREFLECT_FOR_EACH_29(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28)
+#define RYREFLECT_FOR_EACH_30(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29)
+#define RYREFLECT_FOR_EACH_31(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30)
+#define RYREFLECT_FOR_EACH_32(action, x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20, x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, x31) action(x0), action(x1), action(x2), action(x3), action(x4), action(x5), action(x6), action(x7), action(x8), action(x9), action(x10), action(x11), action(x12), action(x13), action(x14), action(x15), action(x16), action(x17), action(x18), action(x19), action(x20), action(x21), action(x22), action(x23), action(x24), action(x25), action(x26), action(x27), action(x28), action(x29), action(x30), action(x31)
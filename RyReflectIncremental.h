@@ -0,0 +1,499 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description 可分段输入的增量JSON解码器：输入可以在任意位置被切开，解码进度在多次调用之间保留
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#pragma once
+#include "RyReflect.h"
+#include <memory>
+
+namespace RyReflect
+{
+    struct IncrementalSink;
+
+    // 增量解码的写入目标：object 指向待写入的值，sink 描述其类型；sink 为空表示跳过该值
+    struct IncrementalTarget
+    {
+        void*                  object = nullptr;
+        const IncrementalSink* sink   = nullptr;
+    };
+
+    // 不能原地追加元素的容器（如 std::set）先把元素解码到临时对象中，完成后再插入
+    using IncrementalTemp = std::unique_ptr<void, void (*)(void*)>;
+
+    // 按类型生成的操作表，解析器通过它写入任意类型而不需要知道具体类型
+    struct IncrementalSink
+    {
+        enum class Shape : std::uint8_t
+        {
+            Scalar,
+            Object,
+            Array,
+        };
+
+        Shape       shape;
+        const char* mismatch; // 遇到与 shape 不符的 '{' 或 '[' 时的错误信息，与 readJson 一致
+
+        // 用 readJson 解码一个完整的标量（字符串、数字、true/false/null）
+        void (*readScalar)(JsonReader& reader, void* object);
+        // 对象：按键定位成员，未知的键返回空目标
+        IncrementalTarget (*member)(void* object, std::string_view key);
+        // 数组：开始时清空，为每个元素创建写入目标，元素完成后提交
+        void (*clear)(void* object);
+        IncrementalTarget (*element)(void* object, IncrementalTemp& temp);
+        void (*commit)(void* object, IncrementalTemp& temp);
+    };
+
+    template <typename T>
+    const IncrementalSink* incrementalSink();
+
+    template <typename T, std::size_t... I>
+    constexpr auto makeIncrementalMembers(std::index_sequence<I...>)
+    {
+        using Member = IncrementalTarget (*)(T&);
+        return std::array<Member, sizeof...(I)>{+[](T& obj) { return IncrementalTarget{ &std::get<I>(obj.getMemberValues()), incrementalSink<MemberType<T, I>>() }; }...};
+    }
+
+    template <typename T>
+    inline constexpr auto incrementalMembers = makeIncrementalMembers<T>(std::make_index_sequence<memberCount<T>>{});
+
+    // 类型分派与 readJson 保持一致
+    template <typename T>
+    constexpr IncrementalSink makeIncrementalSink()
+    {
+        IncrementalSink sink{ IncrementalSink::Shape::Scalar, "expected number", +[](JsonReader& reader, void* object) { readJson(reader, *static_cast<T*>(object)); }, nullptr, nullptr, nullptr, nullptr };
+        if constexpr (std::is_same_v<T, std::string>) {
+            sink.mismatch = "expected string";
+        }
+#ifdef RY_USE_QT
+        else if constexpr (std::is_same_v<T, QString> || std::is_same_v<T, QByteArray>) {
+            sink.mismatch = "expected string";
+        }
+#endif
+        else if constexpr (std::is_same_v<T, bool>) {
+            sink.mismatch = "expected boolean";
+        }
+        else if constexpr (std::is_arithmetic_v<T>) {
+            sink.mismatch = "expected number";
+        }
+        else if constexpr (ForEachable<T>) {
+            sink.shape    = IncrementalSink::Shape::Object;
+            sink.mismatch = "expected object";
+            sink.member   = +[](void* object, std::string_view key) {
+                const std::size_t index = findMemberIndex<T>(key);
+                return index < memberCount<T> ? incrementalMembers<T>[index](*static_cast<T*>(object)) : IncrementalTarget{};
+            };
+        }
+        else if constexpr (is_container<T>::value) {
+            using E       = typename T::value_type;
+            sink.shape    = IncrementalSink::Shape::Array;
+            sink.mismatch = "expected array";
+            sink.clear    = +[](void* object) { static_cast<T*>(object)->clear(); };
+            if constexpr (ReusableContainer<T>) {
+                sink.element = +[](void* object, IncrementalTemp&) {
+                    auto& container = *static_cast<T*>(object);
+                    return IncrementalTarget{ &*container.emplace(container.end()), incrementalSink<E>() };
+                };
+                sink.commit = +[](void*, IncrementalTemp&) { };
+            }
+            else {
+                sink.element = +[](void*, IncrementalTemp& temp) {
+                    temp = IncrementalTemp(new E{}, +[](void* element) { delete static_cast<E*>(element); });
+                    return IncrementalTarget{ temp.get(), incrementalSink<E>() };
+                };
+                sink.commit = +[](void* object, IncrementalTemp& temp) {
+                    auto& container = *static_cast<T*>(object);
+                    container.insert(container.end(), std::move(*static_cast<E*>(temp.get())));
+                    temp.reset();
+                };
+            }
+        }
+        else {
+            static_assert(always_false<T>, "Unsupported type in IncrementalDecoder");
+        }
+        return sink;
+    }
+
+    template <typename T>
+    inline constexpr IncrementalSink incrementalSinkValue = makeIncrementalSink<T>();
+
+    template <typename T>
+    const IncrementalSink* incrementalSink()
+    {
+        return &incrementalSinkValue<T>;
+    }
+
+    // 与具体类型无关的增量解析器：逐字节推进语法状态机，维护对象/数组的帧栈。
+    // 只有跨越分段边界的单个字符串、数字或字面量会被复制暂存，其余输入不做缓冲
+    class IncrementalParser
+    {
+    public:
+        static constexpr std::size_t maxDepth = 1024;
+
+        void reset(IncrementalTarget root)
+        {
+            m_root = root;
+            m_frames.clear();
+            m_state    = State::Value;
+            m_token    = Token::None;
+            m_complete = false;
+            m_offset   = 0;
+            m_error    = nullptr;
+            m_tokenText.clear();
+        }
+
+        bool complete() const { return m_complete; }
+
+        // 送入一段输入，返回消费的字节数。文档在本段中结束时停在结束位置，其后的字节属于下一个文档
+        std::size_t feed(std::string_view chunk)
+        {
+            throwIfFailed();
+            std::size_t pos = 0;
+            m_chunk         = chunk;
+            while (pos < chunk.size() && !m_complete) {
+                if (m_token != Token::None) {
+                    pos = continueToken(pos);
+                    continue;
+                }
+                const char ch = chunk[pos];
+                if (ch == ' ' || ch == '\n' || ch == '\r' || ch == '\t') {
+                    ++pos;
+                    continue;
+                }
+                switch (m_state) {
+                case State::Value:
+                case State::ValueOrEnd:
+                    if (m_state == State::ValueOrEnd && ch == ']') {
+                        ++pos;
+                        endContainer();
+                    }
+                    else {
+                        pos = beginValue(pos);
+                    }
+                    break;
+                case State::Key:
+                case State::KeyOrEnd:
+                    if (ch == '"') {
+                        m_tokenIsKey = true;
+                        pos          = startToken(Token::String, pos);
+                    }
+                    else if (m_state == State::KeyOrEnd && ch == '}') {
+                        ++pos;
+                        endContainer();
+                    }
+                    else {
+                        fail("expected string", pos);
+                    }
+                    break;
+                case State::Colon:
+                    if (ch != ':') {
+                        fail("expected ':'", pos);
+                    }
+                    ++pos;
+                    m_state = State::Value;
+                    break;
+                case State::CommaOrEnd: {
+                    const bool object = m_frames.back().object;
+                    if (ch == ',') {
+                        ++pos;
+                        m_state = object ? State::Key : State::Value;
+                    }
+                    else if (ch == (object ? '}' : ']')) {
+                        ++pos;
+                        endContainer();
+                    }
+                    else {
+                        fail(object ? "expected ',' or '}'" : "expected ',' or ']'", pos);
+                    }
+                    break;
+                }
+                case State::Done: break;
+                }
+            }
+            m_offset += pos;
+            m_chunk = {};
+            return pos;
+        }
+
+        // 输入结束：完成末尾尚未遇到分隔符的数字或字面量，文档不完整时抛出 JsonParseError
+        void finish()
+        {
+            throwIfFailed();
+            if (m_token == Token::Number || m_token == Token::Literal) {
+                completeToken(m_tokenText);
+            }
+            if (!m_complete) {
+                m_tokenStart = m_offset;
+                failToken(m_token == Token::String ? "unterminated string" : "unexpected end of input", 0);
+            }
+        }
+
+    private:
+        enum class State : std::uint8_t
+        {
+            Value,
+            ValueOrEnd, // '[' 之后
+            Key,
+            KeyOrEnd,   // '{' 之后
+            Colon,
+            CommaOrEnd,
+            Done,
+        };
+
+        enum class Token : std::uint8_t
+        {
+            None,
+            String,
+            Number,
+            Literal,
+        };
+
+        struct Frame
+        {
+            bool              object;
+            IncrementalTarget target;                          // 对象或容器本身，sink 为空时整个值被跳过
+            IncrementalTarget pending;                         // 对象：当前键对应的成员；数组：正在解码的元素
+            IncrementalTemp   temp{ nullptr, [](void*) { } };
+        };
+
+        [[noreturn]] void fail(const char* message, std::size_t pos)
+        {
+            m_error       = message;
+            m_errorOffset = m_offset + pos;
+            throw JsonParseError(m_error, m_errorOffset);
+        }
+
+        [[noreturn]] void failToken(const char* message, std::size_t offset)
+        {
+            m_error       = message;
+            m_errorOffset = m_tokenStart + offset;
+            throw JsonParseError(m_error, m_errorOffset);
+        }
+
+        void throwIfFailed() const
+        {
+            if (m_error != nullptr) {
+                throw JsonParseError(m_error, m_errorOffset);
+            }
+        }
+
+        // 当前值的写入目标；数组中每次调用都会创建一个新元素，因此每个值只调用一次
+        IncrementalTarget valueTarget()
+        {
+            if (m_frames.empty()) {
+                return m_root;
+            }
+            Frame& top = m_frames.back();
+            if (!top.object) {
+                top.pending = top.target.sink != nullptr ? top.target.sink->element(top.target.object, top.temp) : IncrementalTarget{};
+            }
+            return top.pending;
+        }
+
+        std::size_t beginValue(std::size_t pos)
+        {
+            const char ch = m_chunk[pos];
+            if (ch == '{' || ch == '[') {
+                if (m_frames.size() >= maxDepth) {
+                    fail("document too deep", pos);
+                }
+                const bool object              = ch == '{';
+                const IncrementalTarget target = valueTarget();
+                if (target.sink != nullptr) {
+                    if (target.sink->shape != (object ? IncrementalSink::Shape::Object : IncrementalSink::Shape::Array)) {
+                        fail(target.sink->mismatch, pos);
+                    }
+                    if (!object) {
+                        target.sink->clear(target.object);
+                    }
+                }
+                m_frames.push_back(Frame{ object, target, {} });
+                m_state = object ? State::KeyOrEnd : State::ValueOrEnd;
+                return pos + 1;
+            }
+            m_tokenIsKey = false;
+            if (ch == '"') {
+                return startToken(Token::String, pos);
+            }
+            if (ch == '-' || (ch >= '0' && ch <= '9')) {
+                return startToken(Token::Number, pos);
+            }
+            if (ch >= 'a' && ch <= 'z') {
+                return startToken(Token::Literal, pos);
+            }
+            const IncrementalTarget target = valueTarget();
+            fail(target.sink != nullptr ? target.sink->mismatch : "unexpected character", pos);
+        }
+
+        void endContainer()
+        {
+            m_frames.pop_back();
+            valueCompleted();
+        }
+
+        void valueCompleted()
+        {
+            if (m_frames.empty()) {
+                m_complete = true;
+                m_state    = State::Done;
+                return;
+            }
+            Frame& top = m_frames.back();
+            if (!top.object && top.target.sink != nullptr) {
+                top.target.sink->commit(top.target.object, top.temp);
+            }
+            m_state = State::CommaOrEnd;
+        }
+
+        std::size_t startToken(Token token, std::size_t pos)
+        {
+            m_token      = token;
+            m_tokenBegin = pos;
+            m_tokenStart = m_offset + pos;
+            m_escape     = false;
+            m_tokenText.clear();
+            return continueToken(token == Token::String ? pos + 1 : pos);
+        }
+
+        static bool isNumberChar(char ch) { return (ch >= '0' && ch <= '9') || ch == '-' || ch == '+' || ch == '.' || ch == 'e' || ch == 'E'; }
+
+        // 从 pos 继续扫描当前记号，返回新的位置；记号在本段内未结束时暂存已扫描的部分
+        std::size_t continueToken(std::size_t pos)
+        {
+            const std::size_t size = m_chunk.size();
+            std::size_t end        = std::string_view::npos;
+            if (m_token == Token::String) {
+                while (pos < size) {
+                    if (m_escape) {
+                        m_escape = false;
+                        ++pos;
+                        continue;
+                    }
+                    const std::size_t special = m_chunk.find_first_of("\"\\", pos);
+                    if (special == std::string_view::npos) {
+                        pos = size;
+                        break;
+                    }
+                    if (m_chunk[special] == '\\') {
+                        m_escape = true;
+                        pos      = special + 1;
+                        continue;
+                    }
+                    end = special + 1;
+                    break;
+                }
+            }
+            else {
+                const bool number = m_token == Token::Number;
+                while (pos < size && (number ? isNumberChar(m_chunk[pos]) : (m_chunk[pos] >= 'a' && m_chunk[pos] <= 'z'))) {
+                    ++pos;
+                }
+                if (pos < size) {
+                    end = pos;
+                }
+            }
+            if (end == std::string_view::npos) {
+                m_tokenText.append(m_chunk.substr(m_tokenBegin));
+                m_tokenBegin = 0;
+                return size;
+            }
+            if (m_tokenText.empty()) {
+                completeToken(m_chunk.substr(m_tokenBegin, end - m_tokenBegin));
+            }
+            else {
+                m_tokenText.append(m_chunk.substr(0, end));
+                completeToken(m_tokenText);
+            }
+            return end;
+        }
+
+        // 完整的记号交给 JsonReader 解码：字符串的反转义、数字的范围检查和错误信息都与 readJson 一致
+        void completeToken(std::string_view text)
+        {
+            const Token token = m_token;
+            m_token           = Token::None;
+            JsonReader reader(text);
+            if (token == Token::String && m_tokenIsKey) {
+                std::string_view key;
+                if (!reader.readStringView(key, m_keyScratch)) {
+                    failToken(reader.errorMessage(), reader.errorOffset());
+                }
+                Frame& top  = m_frames.back();
+                top.pending = top.target.sink != nullptr ? top.target.sink->member(top.target.object, key) : IncrementalTarget{};
+                m_state     = State::Colon;
+                m_tokenText.clear();
+                return;
+            }
+            const IncrementalTarget target = valueTarget();
+            if (target.sink != nullptr) {
+                target.sink->readScalar(reader, target.object);
+            }
+            else {
+                reader.skipValue();
+            }
+            if (reader.ok() && !reader.atEnd()) {
+                reader.fail(token == Token::Number ? "invalid number" : "invalid literal");
+            }
+            if (!reader.ok()) {
+                failToken(reader.errorMessage(), reader.errorOffset());
+            }
+            m_tokenText.clear();
+            valueCompleted();
+        }
+
+        IncrementalTarget  m_root;
+        std::vector<Frame> m_frames;
+        State              m_state      = State::Value;
+        Token              m_token      = Token::None;
+        bool               m_tokenIsKey = false;
+        bool               m_escape     = false;
+        bool               m_complete   = false;
+        std::string_view   m_chunk;
+        std::size_t        m_offset      = 0; // 之前各段累计消费的字节数
+        std::size_t        m_tokenBegin  = 0; // 当前记号在本段中的起始位置
+        std::size_t        m_tokenStart  = 0; // 当前记号在整个文档中的偏移
+        std::string        m_tokenText;       // 跨越分段边界的记号
+        std::string        m_keyScratch;
+        const char*        m_error       = nullptr;
+        std::size_t        m_errorOffset = 0;
+    };
+
+    // 推送式解码器：输入可以按任意大小分段送入，文档结束时得到完整的 T。
+    // 只暂存跨越分段边界的单个记号，不需要先缓冲整个文档；出错时抛出 JsonParseError，之后需调用 reset()
+    template <typename T>
+    class IncrementalDecoder
+    {
+    public:
+        IncrementalDecoder() { reset(); }
+
+        IncrementalDecoder(const IncrementalDecoder&)            = delete;
+        IncrementalDecoder& operator=(const IncrementalDecoder&) = delete;
+
+        // 送入一段输入，返回消费的字节数。ready() 为 true 时文档已结束，剩余的字节属于下一个文档
+        std::size_t feed(std::string_view chunk) { return m_parser.feed(chunk); }
+
+        // 输入结束时调用，用于完成顶层的数字等没有结束符的文档；文档不完整时抛出 JsonParseError
+        void finish() { m_parser.finish(); }
+
+        bool ready() const { return m_parser.complete(); }
+
+        // 取出解码完成的对象，并开始解码下一个文档
+        T take()
+        {
+            T value = std::move(m_value);
+            reset();
+            return value;
+        }
+
+        void reset()
+        {
+            m_value = T{};
+            m_parser.reset(IncrementalTarget{ &m_value, incrementalSink<T>() });
+        }
+
+    private:
+        T                 m_value{};
+        IncrementalParser m_parser;
+    };
+} // namespace RyReflect
@@ -0,0 +1,232 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description 按需解码的延迟视图：保留原始JSON文本，只解码访问到的成员，未修改的成员原样写回
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#pragma once
+#include "RyReflect.h"
+#include <bitset>
+
+namespace RyReflect
+{
+    template <typename T, JsonSink Sink, std::size_t... I>
+    constexpr auto makeMemberWriters(std::index_sequence<I...>)
+    {
+        using Writer = void (*)(const T&, Sink&);
+        return std::array<Writer, sizeof...(I)>{+[](const T& obj, Sink& sink) { writeJson(std::get<I>(obj.getMemberValues()), sink); }...};
+    }
+
+    // 按成员下标分派的写出函数表
+    template <typename T, JsonSink Sink>
+    inline constexpr auto memberWriters = makeMemberWriters<T, Sink>(std::make_index_sequence<memberCount<T>>{});
+
+    // 持有原始JSON文本的延迟视图。第一次访问时扫描一遍文本，记录各成员值的位置，之后 get<"name">() 只解码该成员并缓存结果。
+    // 写出时没有修改过的成员（包括 T 中没有的键）按原始字节拷贝，完全没有修改时整段输出原文。
+    // 缓存在 const 成员函数中填充，同一对象不能在多个线程中同时访问
+    template <typename T>
+    class Lazy
+    {
+    public:
+        Lazy()
+            : m_text("{}")
+        { }
+
+        explicit Lazy(std::string text)
+            : m_text(std::move(text))
+        { }
+
+        // 替换原文并清除所有缓存和修改
+        void assign(std::string text)
+        {
+            m_text    = std::move(text);
+            m_object  = T{};
+            m_indexed = false;
+            m_decoded.reset();
+            m_modified.reset();
+            m_entries.clear();
+        }
+
+        const std::string& text() const { return m_text; }
+
+        // 原文中是否有该成员
+        template <FixedString Name>
+        bool contains() const
+        {
+            buildIndex();
+            return m_slots[memberIndex<T, Name>()] != 0;
+        }
+
+        // 解码并缓存一个成员，原文中没有该成员或值为 null 时返回默认值；格式错误时抛出 JsonParseError
+        template <FixedString Name>
+        const MemberType<T, memberIndex<T, Name>()>& get() const
+        {
+            constexpr std::size_t index = memberIndex<T, Name>();
+            decode(index);
+            return std::get<index>(m_object.getMemberValues());
+        }
+
+        // 取得可修改的成员，该成员在写出时重新编码
+        template <FixedString Name>
+        MemberType<T, memberIndex<T, Name>()>& edit()
+        {
+            constexpr std::size_t index = memberIndex<T, Name>();
+            decode(index);
+            m_modified.set(index);
+            return std::get<index>(m_object.getMemberValues());
+        }
+
+        template <FixedString Name, typename U>
+        void set(U&& value)
+        {
+            constexpr std::size_t index = memberIndex<T, Name>();
+            buildIndex();
+            m_decoded.set(index);
+            m_modified.set(index);
+            std::get<index>(m_object.getMemberValues()) = std::forward<U>(value);
+        }
+
+        bool modified() const { return m_modified.any(); }
+
+        // 解码全部成员
+        const T& value() const
+        {
+            for (std::size_t i = 0; i < memberCount<T>; ++i) {
+                decode(i);
+            }
+            return m_object;
+        }
+
+        // 写出为JSON文本：没有修改时原样输出原文，否则只重新编码修改过的成员
+        template <JsonSink Sink>
+        void write(Sink& sink) const
+        {
+            if (!modified()) {
+                sink.append(m_text.data(), m_text.size());
+                return;
+            }
+            buildIndex();
+            constexpr auto names    = memberNameArray<T>();
+            constexpr auto& writers = memberWriters<T, Sink>;
+            bool first              = true;
+            auto writeMember        = [&](std::size_t member) {
+                sink.push_back(first ? '{' : ',');
+                first = false;
+                writeJsonString(sink, names[member]);
+                sink.push_back(':');
+                writers[member](m_object, sink);
+            };
+            for (std::size_t i = 0; i < m_entries.size(); ++i) {
+                const Entry& entry = m_entries[i];
+                if (entry.member < memberCount<T> && m_modified.test(entry.member)) {
+                    // 重复的键只在最后一次出现的位置写出新值
+                    if (m_slots[entry.member] == i + 1) {
+                        writeMember(entry.member);
+                    }
+                    continue;
+                }
+                sink.push_back(first ? '{' : ',');
+                first = false;
+                sink.append(m_text.data() + entry.keyBegin, entry.valueEnd - entry.keyBegin);
+            }
+            for (std::size_t member = 0; member < memberCount<T>; ++member) {
+                if (m_modified.test(member) && m_slots[member] == 0) {
+                    writeMember(member);
+                }
+            }
+            if (first) {
+                sink.push_back('{');
+            }
+            sink.push_back('}');
+        }
+
+    private:
+        // 原文中的一个键值对，偏移相对于原文开头
+        struct Entry
+        {
+            std::uint32_t keyBegin;
+            std::uint32_t valueBegin;
+            std::uint32_t valueEnd;
+            std::uint32_t member; // 成员下标，T 中没有该键时为 memberCount<T>
+        };
+
+        // 扫描顶层对象，记录各键值对的位置；值只做括号与引号匹配，解码时再检查
+        void buildIndex() const
+        {
+            if (m_indexed) {
+                return;
+            }
+            if (m_text.size() > std::numeric_limits<std::uint32_t>::max()) {
+                throw std::length_error("RyReflect::Lazy: text too large");
+            }
+            m_entries.clear();
+            m_slots.fill(0);
+            JsonReader reader(m_text);
+            std::string scratch;
+            if (!reader.consumeNull() && reader.expect('{', "expected object", JsonErrorCode::TypeMismatch) && !reader.consume('}')) {
+                do {
+                    std::string_view key;
+                    reader.peek();
+                    const std::size_t keyBegin = reader.offset();
+                    if (!reader.readStringView(key, scratch) || !reader.expect(':', "expected ':'")) {
+                        break;
+                    }
+                    reader.peek();
+                    const std::size_t valueBegin = reader.offset();
+                    if (!reader.skipValue()) {
+                        break;
+                    }
+                    const std::size_t member = findMemberIndex<T>(key);
+                    m_entries.push_back(Entry{ static_cast<std::uint32_t>(keyBegin), static_cast<std::uint32_t>(valueBegin), static_cast<std::uint32_t>(reader.offset()), static_cast<std::uint32_t>(member) });
+                    if (member < memberCount<T>) {
+                        m_slots[member] = static_cast<std::uint32_t>(m_entries.size());
+                    }
+                } while (reader.consume(','));
+                reader.expect('}', "expected ',' or '}'");
+            }
+            if (reader.ok() && !reader.atEnd()) {
+                reader.fail("unexpected trailing characters");
+            }
+            if (!reader.ok()) {
+                throw JsonParseError(reader.errorMessage(), reader.errorOffset());
+            }
+            m_indexed = true;
+        }
+
+        void decode(std::size_t index) const
+        {
+            if (m_decoded.test(index)) {
+                return;
+            }
+            buildIndex();
+            if (m_slots[index] != 0) {
+                const Entry& entry = m_entries[m_slots[index] - 1];
+                JsonReader reader(std::string_view(m_text.data(), entry.valueEnd));
+                reader.seek(entry.valueBegin);
+                memberReaders<T>[index](reader, m_object);
+                if (reader.ok() && !reader.atEnd()) {
+                    reader.fail("unexpected trailing characters");
+                }
+                if (!reader.ok()) {
+                    throw JsonParseError(reader.errorMessage(), reader.errorOffset());
+                }
+            }
+            m_decoded.set(index);
+        }
+
+        std::string                                       m_text;
+        mutable T                                         m_object{};
+        mutable bool                                      m_indexed = false;
+        mutable std::bitset<memberCount<T>>               m_decoded;
+        std::bitset<memberCount<T>>                       m_modified;
+        mutable std::vector<Entry>                        m_entries;
+        mutable std::array<std::uint32_t, memberCount<T>> m_slots{}; // 成员最后一次出现的 m_entries 下标 + 1，0 表示原文中没有
+    };
+
+    // 使 toJsonString(lazy) 可以直接使用
+    template <typename T, JsonSink Sink>
+    void writeJson(const Lazy<T>& value, Sink& sink)
+    {
+        value.write(sink);
+    }
+} // namespace RyReflect
@@ -0,0 +1,408 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description NDJSON（每行一个JSON值）的流式读写，缓冲区大小有上限，可选按行并行解码并保持顺序
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#pragma once
+#include "RyReflectParallel.h"
+#include <cerrno>
+#include <climits>
+#include <istream>
+#include <ostream>
+#include <system_error>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace RyReflect
+{
+    // NDJSON 中某一行的解析错误，offset 为错误位置在整个输入流中的字节偏移，line 从 1 开始
+    class NdjsonParseError : public JsonParseError
+    {
+    public:
+        NdjsonParseError(const std::string& message, std::size_t offset, std::size_t line)
+            : JsonParseError(message + " on line " + std::to_string(line), offset)
+            , m_line(line)
+        { }
+
+        std::size_t line() const { return m_line; }
+
+    private:
+        std::size_t m_line;
+    };
+
+    struct NdjsonOptions
+    {
+        std::size_t bufferSize  = 64 * 1024;         // 每次从输入读取的字节数
+        std::size_t maxLineSize = 64 * 1024 * 1024;  // 单行长度上限（不含结尾的 \n），超过时抛出 NdjsonParseError，读缓冲区不会超过该大小加一
+        bool        parallel    = false;             // 是否按批并行解码
+        ThreadPool* pool        = nullptr;           // 并行解码使用的线程池，为空时使用 ThreadPool::global()
+        std::size_t batchLines  = 4096;              // 并行解码时每批的最大行数
+        std::size_t batchBytes  = 4 * 1024 * 1024;   // 并行解码时每批的最大字节数（一行超过时该批只含这一行）
+    };
+
+    // 从文件描述符读取至多 size 字节，返回 0 表示结束
+    inline std::size_t readFileDescriptor(int fd, char* data, std::size_t size)
+    {
+        for (;;) {
+#ifdef _WIN32
+            const auto count = ::_read(fd, data, static_cast<unsigned>(std::min<std::size_t>(size, INT_MAX)));
+#else
+            const auto count = ::read(fd, data, size);
+#endif
+            if (count >= 0) {
+                return static_cast<std::size_t>(count);
+            }
+            if (errno != EINTR) {
+                throw std::system_error(errno, std::generic_category(), "RyReflect: read failed");
+            }
+        }
+    }
+
+    // 把 size 字节全部写入文件描述符，处理部分写入
+    inline void writeFileDescriptor(int fd, const char* data, std::size_t size)
+    {
+        while (size != 0) {
+#ifdef _WIN32
+            const auto count = ::_write(fd, data, static_cast<unsigned>(std::min<std::size_t>(size, INT_MAX)));
+#else
+            const auto count = ::write(fd, data, size);
+#endif
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::system_error(errno, std::generic_category(), "RyReflect: write failed");
+            }
+            data += count;
+            size -= static_cast<std::size_t>(count);
+        }
+    }
+
+    // 逐行写出对象。输出先累积在缓冲区中，超过 bufferSize 时写出；
+    // writeJson 会转义字符串中的换行，因此每个对象恰好占一行
+    template <typename T>
+    class NdjsonWriter
+    {
+    public:
+        using Sink = std::function<void(const char*, std::size_t)>;
+
+        explicit NdjsonWriter(Sink sink, std::size_t bufferSize = 64 * 1024)
+            : m_sink(std::move(sink))
+            , m_bufferSize(bufferSize)
+        {
+            m_buffer.reserve(bufferSize);
+        }
+
+        explicit NdjsonWriter(std::ostream& stream, std::size_t bufferSize = 64 * 1024)
+            : NdjsonWriter(
+                  [&stream](const char* data, std::size_t size) {
+                      if (!stream.write(data, static_cast<std::streamsize>(size))) {
+                          throw std::runtime_error("RyReflect: stream write failed");
+                      }
+                  },
+                  bufferSize)
+        { }
+
+        explicit NdjsonWriter(int fd, std::size_t bufferSize = 64 * 1024)
+            : NdjsonWriter([fd](const char* data, std::size_t size) { writeFileDescriptor(fd, data, size); }, bufferSize)
+        { }
+
+        // 析构时尽量写出剩余内容并忽略错误，需要感知写入错误时应在析构前调用 flush()
+        ~NdjsonWriter()
+        {
+            try {
+                flush();
+            }
+            catch (...) {
+            }
+        }
+
+        NdjsonWriter(const NdjsonWriter&)            = delete;
+        NdjsonWriter& operator=(const NdjsonWriter&) = delete;
+
+        void write(const T& obj)
+        {
+            writeJson(obj, m_buffer);
+            m_buffer.push_back('\n');
+            ++m_count;
+            if (m_buffer.size() >= m_bufferSize) {
+                flush();
+            }
+        }
+
+        template <typename Range>
+        void writeAll(const Range& objects)
+        {
+            for (const auto& obj : objects) {
+                write(obj);
+            }
+        }
+
+        void flush()
+        {
+            if (!m_buffer.empty()) {
+                m_sink(m_buffer.data(), m_buffer.size());
+                m_buffer.clear();
+            }
+        }
+
+        // 已写入的对象个数
+        std::size_t count() const { return m_count; }
+
+    private:
+        Sink        m_sink;
+        std::string m_buffer;
+        std::size_t m_bufferSize;
+        std::size_t m_count = 0;
+    };
+
+    // 逐行读取对象，空行被跳过，行尾的 \r 被忽略。读缓冲区不超过 maxLineSize + 1，
+    // 启用 parallel 后按批读取若干行，在线程池中并行解码，再按原顺序逐个返回
+    template <typename T>
+    class NdjsonReader
+    {
+    public:
+        // source(data, size) 读取至多 size 字节，返回 0 表示结束
+        using Source = std::function<std::size_t(char*, std::size_t)>;
+
+        explicit NdjsonReader(Source source, const NdjsonOptions& options = {})
+            : m_source(std::move(source))
+            , m_options(options)
+        {
+            m_buffer.resize(std::max<std::size_t>(1, std::min(m_options.bufferSize, bufferLimit())));
+        }
+
+        explicit NdjsonReader(std::istream& stream, const NdjsonOptions& options = {})
+            : NdjsonReader(
+                  [&stream](char* data, std::size_t size) {
+                      stream.read(data, static_cast<std::streamsize>(size));
+                      if (stream.bad()) {
+                          throw std::runtime_error("RyReflect: stream read failed");
+                      }
+                      return static_cast<std::size_t>(stream.gcount());
+                  },
+                  options)
+        { }
+
+        explicit NdjsonReader(int fd, const NdjsonOptions& options = {})
+            : NdjsonReader([fd](char* data, std::size_t size) { return readFileDescriptor(fd, data, size); }, options)
+        { }
+
+        NdjsonReader(const NdjsonReader&)            = delete;
+        NdjsonReader& operator=(const NdjsonReader&) = delete;
+
+        // 读取下一条记录到 obj，obj 先被重置为默认值，与 fromJsonString 一致；没有更多记录时返回 false。
+        // 某一行格式错误时抛出 NdjsonParseError，该行被跳过，之后可以继续读取
+        bool read(T& obj)
+        {
+            if (m_options.parallel) {
+                return readBatched(obj);
+            }
+            std::string_view line;
+            std::size_t offset = 0;
+            if (!nextLine(line, offset)) {
+                return false;
+            }
+            if (m_lineError != nullptr) {
+                throw NdjsonParseError(m_lineError, offset, m_lineNumber);
+            }
+            obj                     = T{};
+            std::size_t errorOffset = 0;
+            if (const char* error = decodeLine(line, obj, errorOffset)) {
+                throw NdjsonParseError(error, offset + errorOffset, m_lineNumber);
+            }
+            m_recordLine = m_lineNumber;
+            return true;
+        }
+
+        // 最近一次 read 返回的记录所在的行号，从 1 开始
+        std::size_t lineNumber() const { return m_recordLine; }
+
+    private:
+        struct BatchLine
+        {
+            std::size_t begin       = 0; // 在 m_batchText 中的位置
+            std::size_t size        = 0;
+            std::size_t number      = 0;
+            std::size_t offset      = 0; // 在输入流中的字节偏移
+            const char* error       = nullptr;
+            std::size_t errorOffset = 0;
+        };
+
+        static const char* decodeLine(std::string_view line, T& obj, std::size_t& errorOffset)
+        {
+            JsonReader reader(line);
+            readJson(reader, obj);
+            if (reader.ok() && !reader.atEnd()) {
+                reader.fail("unexpected trailing characters");
+            }
+            if (!reader.ok()) {
+                errorOffset = reader.errorOffset();
+                return reader.errorMessage();
+            }
+            return nullptr;
+        }
+
+        // 取下一条非空行，返回的视图在下一次调用前有效。超过 maxLineSize 的行被丢弃，
+        // 此时返回空行并把 m_lineError 设为错误描述，由调用方在该行的位置报告
+        bool nextLine(std::string_view& line, std::size_t& offset)
+        {
+            m_lineError = nullptr;
+            for (;;) {
+                const char* data = m_buffer.data();
+                const void* found = m_begin == m_end ? nullptr : std::memchr(data + m_begin, '\n', m_end - m_begin);
+                std::size_t lineEnd;
+                if (found != nullptr) {
+                    lineEnd = static_cast<std::size_t>(static_cast<const char*>(found) - data);
+                }
+                else if (m_eof) {
+                    if (m_begin == m_end) {
+                        return false;
+                    }
+                    lineEnd = m_end;
+                }
+                else {
+                    const std::size_t lineStart = m_bufferOffset + m_begin;
+                    if (fill()) {
+                        continue;
+                    }
+                    line        = {};
+                    offset      = lineStart;
+                    m_lineError = "line too long";
+                    ++m_lineNumber;
+                    return true;
+                }
+                line   = std::string_view(data + m_begin, lineEnd - m_begin);
+                offset = m_bufferOffset + m_begin;
+                m_begin = found != nullptr ? lineEnd + 1 : lineEnd;
+                ++m_lineNumber;
+                if (!line.empty() && line.back() == '\r') {
+                    line.remove_suffix(1);
+                }
+                if (line.find_first_not_of(" \t\r") != std::string_view::npos) {
+                    return true;
+                }
+            }
+        }
+
+        // 缓冲区上限：maxLineSize 字节的行加上结尾的 \n
+        std::size_t bufferLimit() const
+        {
+            return m_options.maxLineSize == std::numeric_limits<std::size_t>::max() ? m_options.maxLineSize : m_options.maxLineSize + 1;
+        }
+
+        // 把未处理的数据移到缓冲区开头并继续读取；一行占满缓冲区时加倍扩容，直到 bufferLimit()。
+        // 一行超过 maxLineSize 时把它丢弃到下一个换行符之后并返回 false
+        bool fill()
+        {
+            if (m_begin != 0) {
+                std::memmove(m_buffer.data(), m_buffer.data() + m_begin, m_end - m_begin);
+                m_bufferOffset += m_begin;
+                m_end -= m_begin;
+                m_begin = 0;
+            }
+            if (m_end == m_buffer.size()) {
+                if (m_buffer.size() >= bufferLimit()) {
+                    discardLine();
+                    return false;
+                }
+                m_buffer.resize(std::min(m_buffer.size() * 2, bufferLimit()));
+            }
+            const std::size_t count = m_source(m_buffer.data() + m_end, m_buffer.size() - m_end);
+            if (count == 0) {
+                m_eof = true;
+            }
+            m_end += count;
+            return true;
+        }
+
+        // 丢弃缓冲区中的数据以及之后的输入，直到下一个换行符（包括换行符）或输入结束
+        void discardLine()
+        {
+            for (;;) {
+                m_bufferOffset += m_end;
+                m_begin = 0;
+                m_end   = m_source(m_buffer.data(), m_buffer.size());
+                if (m_end == 0) {
+                    m_eof = true;
+                    return;
+                }
+                if (const void* found = std::memchr(m_buffer.data(), '\n', m_end)) {
+                    m_begin = static_cast<std::size_t>(static_cast<const char*>(found) - m_buffer.data()) + 1;
+                    return;
+                }
+            }
+        }
+
+        bool readBatched(T& obj)
+        {
+            while (m_nextInBatch == m_batchLines.size()) {
+                if (!fillBatch()) {
+                    return false;
+                }
+            }
+            const BatchLine& line = m_batchLines[m_nextInBatch];
+            T& decoded            = m_batch[m_nextInBatch];
+            ++m_nextInBatch;
+            if (line.error != nullptr) {
+                throw NdjsonParseError(line.error, line.offset + line.errorOffset, line.number);
+            }
+            obj          = std::move(decoded);
+            m_recordLine = line.number;
+            return true;
+        }
+
+        // 读取一批行并并行解码；每行的错误单独记录，按顺序返回到该行时再抛出
+        bool fillBatch()
+        {
+            m_batchText.clear();
+            m_batchLines.clear();
+            m_nextInBatch = 0;
+            std::string_view line;
+            std::size_t offset = 0;
+            while (m_batchLines.size() < m_options.batchLines && m_batchText.size() < m_options.batchBytes && nextLine(line, offset)) {
+                m_batchLines.push_back(BatchLine{ m_batchText.size(), line.size(), m_lineNumber, offset, m_lineError });
+                m_batchText.append(line);
+            }
+            const std::size_t count = m_batchLines.size();
+            if (count == 0) {
+                return false;
+            }
+            m_batch.resize(count);
+            ThreadPool& pool             = m_options.pool != nullptr ? *m_options.pool : ThreadPool::global();
+            const std::size_t chunkCount = std::min(count / 16 + 1, pool.threadCount() * 4);
+            pool.parallelFor(count, chunkCount, [this](std::size_t, std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    BatchLine& batchLine = m_batchLines[i];
+                    if (batchLine.error != nullptr) {
+                        continue;
+                    }
+                    m_batch[i]           = T{};
+                    batchLine.error      = decodeLine(std::string_view(m_batchText).substr(batchLine.begin, batchLine.size), m_batch[i], batchLine.errorOffset);
+                }
+            });
+            return true;
+        }
+
+        Source        m_source;
+        NdjsonOptions m_options;
+
+        std::string m_buffer;
+        std::size_t m_begin        = 0; // 缓冲区中未处理数据的范围
+        std::size_t m_end          = 0;
+        std::size_t m_bufferOffset = 0; // m_buffer[0] 在输入流中的字节偏移
+        std::size_t m_lineNumber   = 0; // 已读取的行数，包括空行
+        std::size_t m_recordLine   = 0;
+        bool        m_eof          = false;
+        const char* m_lineError    = nullptr; // nextLine 返回的行无法解码的原因
+
+        std::string            m_batchText;
+        std::vector<BatchLine> m_batchLines;
+        std::vector<T>         m_batch;
+        std::size_t            m_nextInBatch = 0;
+    };
+} // namespace RyReflect
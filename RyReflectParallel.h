@@ -0,0 +1,481 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description 大容器的并行序列化与反序列化：工作窃取线程池，分块编码后按顺序拼接，按结构索引分块解码
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#pragma once
+#include "RyReflectParser.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace RyReflect
+{
+    // 工作窃取线程池：每个工作线程有自己的任务队列，优先从队尾取自己的任务，空闲时从其他队列的队头窃取。
+    // 调用 parallelFor 的线程在等待期间也会执行任务，因此在任务内部嵌套调用不会死锁
+    class ThreadPool
+    {
+    public:
+        explicit ThreadPool(std::size_t threadCount = std::max(1u, std::thread::hardware_concurrency()))
+        {
+            threadCount = std::max<std::size_t>(1, threadCount);
+            for (std::size_t i = 0; i < threadCount; ++i) {
+                m_queues.push_back(std::make_unique<WorkQueue>());
+            }
+            for (std::size_t i = 0; i < threadCount; ++i) {
+                m_threads.emplace_back([this, i] { workerLoop(i); });
+            }
+        }
+
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard lock(m_mutex);
+                m_stop = true;
+            }
+            m_condition.notify_all();
+            for (auto& thread : m_threads) {
+                thread.join();
+            }
+        }
+
+        ThreadPool(const ThreadPool&)            = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        std::size_t threadCount() const { return m_threads.size(); }
+
+        // 进程内共享的线程池，线程数等于硬件并发数
+        static ThreadPool& global()
+        {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        // 把 [0, count) 均分为 chunkCount 块，并行执行 f(chunk, begin, end)，全部完成后返回；
+        // 任务抛出的第一个异常会在调用线程重新抛出
+        template <typename F>
+        void parallelFor(std::size_t count, std::size_t chunkCount, F&& f)
+        {
+            chunkCount = std::clamp<std::size_t>(chunkCount, 1, std::max<std::size_t>(1, count));
+            if (chunkCount == 1) {
+                f(std::size_t{0}, std::size_t{0}, count);
+                return;
+            }
+            std::atomic<std::size_t> remaining{ chunkCount };
+            std::exception_ptr error;
+            std::mutex errorMutex;
+            const auto runChunk = [&](std::size_t chunk) {
+                try {
+                    f(chunk, count * chunk / chunkCount, count * (chunk + 1) / chunkCount);
+                }
+                catch (...) {
+                    std::lock_guard lock(errorMutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+                remaining.fetch_sub(1, std::memory_order_acq_rel);
+            };
+            for (std::size_t chunk = 1; chunk < chunkCount; ++chunk) {
+                push(chunk % m_queues.size(), [&runChunk, chunk] { runChunk(chunk); });
+            }
+            runChunk(0);
+            while (remaining.load(std::memory_order_acquire) != 0) {
+                if (!runOne(m_queues.size())) {
+                    std::this_thread::yield();
+                }
+            }
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+    private:
+        using Task = std::function<void()>;
+
+        struct WorkQueue
+        {
+            std::mutex       mutex;
+            std::deque<Task> tasks;
+        };
+
+        void push(std::size_t queue, Task task)
+        {
+            {
+                std::lock_guard lock(m_queues[queue]->mutex);
+                m_queues[queue]->tasks.push_back(std::move(task));
+            }
+            m_queued.fetch_add(1, std::memory_order_release);
+            {
+                // 持锁后再通知，避免工作线程在检查条件与进入等待之间错过唤醒
+                std::lock_guard lock(m_mutex);
+            }
+            m_condition.notify_one();
+        }
+
+        // self 为自身队列下标，外部线程传入 m_queues.size()，只窃取
+        bool runOne(std::size_t self)
+        {
+            Task task;
+            if (self < m_queues.size()) {
+                std::lock_guard lock(m_queues[self]->mutex);
+                if (!m_queues[self]->tasks.empty()) {
+                    task = std::move(m_queues[self]->tasks.back());
+                    m_queues[self]->tasks.pop_back();
+                }
+            }
+            for (std::size_t i = 1; !task && i <= m_queues.size(); ++i) {
+                auto& victim = *m_queues[(self + i) % m_queues.size()];
+                std::lock_guard lock(victim.mutex);
+                if (!victim.tasks.empty()) {
+                    task = std::move(victim.tasks.front());
+                    victim.tasks.pop_front();
+                }
+            }
+            if (!task) {
+                return false;
+            }
+            m_queued.fetch_sub(1, std::memory_order_relaxed);
+            task();
+            return true;
+        }
+
+        void workerLoop(std::size_t index)
+        {
+            for (;;) {
+                if (runOne(index)) {
+                    continue;
+                }
+                std::unique_lock lock(m_mutex);
+                m_condition.wait(lock, [this] { return m_stop || m_queued.load(std::memory_order_acquire) != 0; });
+                if (m_stop && m_queued.load(std::memory_order_acquire) == 0) {
+                    return;
+                }
+            }
+        }
+
+        std::vector<std::unique_ptr<WorkQueue>> m_queues;
+        std::vector<std::thread>                m_threads;
+        std::mutex                              m_mutex;
+        std::condition_variable                 m_condition;
+        std::atomic<std::size_t>                m_queued{ 0 };
+        bool                                    m_stop = false;
+    };
+
+    // 元素数不少于 minElements 的容器才会并行处理，更小的容器分块的开销大于收益
+    struct ParallelOptions
+    {
+        ThreadPool* pool        = nullptr; // 为空时使用 ThreadPool::global()
+        std::size_t minElements = 4096;
+
+        ThreadPool& threadPool() const { return pool != nullptr ? *pool : ThreadPool::global(); }
+
+        // 每个线程分到几块，让先完成的线程可以窃取剩余的块
+        std::size_t chunkCount(std::size_t count) const { return std::min(count / std::max<std::size_t>(1, minElements / 4), threadPool().threadCount() * 4); }
+    };
+
+    // 可以按下标并行访问的容器，如 std::vector、std::deque；std::vector<bool> 的元素不可单独寻址，不在此列。
+    // std::string、QString 等同样可以按下标访问，但写出为JSON字符串，也不在此列
+    template <typename T>
+    concept ParallelContainer = is_container<T>::value && !is_string_like_v<T> && requires(T& c, std::size_t i) {
+        c.size();
+        { c[i] } -> std::same_as<typename T::value_type&>;
+    };
+
+    // 解码时额外要求可以预先调整大小，元素按下标原地写入
+    template <typename T>
+    concept ParallelDecodableContainer = ParallelContainer<T> && std::default_initializable<typename T::value_type> && requires(T& c, std::size_t n) { c.resize(n); };
+
+    // 把容器转换为 JsonArray，各块并行转换元素后按顺序放入数组
+    template <ParallelContainer Container>
+    JsonArray toJsonArrayParallel(const Container& container, const ParallelOptions& options = {})
+    {
+        if (container.size() < options.minElements) {
+            return toJsonArray(container);
+        }
+        std::vector<JsonValue> values(container.size());
+        options.threadPool().parallelFor(container.size(), options.chunkCount(container.size()), [&](std::size_t, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                values[i] = toJsonValue(container[i]);
+            }
+        });
+#ifdef RY_USE_QT
+        JsonArray jsonArray;
+        for (auto& value : values) {
+            jsonArray.push_back(std::move(value));
+        }
+        return jsonArray;
+#else
+        return values;
+#endif
+    }
+
+    // 从 JsonArray 并行转换出容器，各块按下标原地写入元素
+    template <ParallelDecodableContainer Container>
+    Container fromJsonArrayParallel(const JsonArray& jsonArray, const ParallelOptions& options = {})
+    {
+        const auto count = static_cast<std::size_t>(jsonArray.size());
+        if (count < options.minElements) {
+            return fromJsonArray<Container>(jsonArray);
+        }
+        using T = typename Container::value_type;
+        Container container;
+        container.resize(count);
+        options.threadPool().parallelFor(count, options.chunkCount(count), [&](std::size_t, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+#ifdef RY_USE_QT
+                container[i] = fromJsonValue<T>(jsonArray.at(static_cast<qsizetype>(i)));
+#else
+                container[i] = fromJsonValue<T>(jsonArray[i]);
+#endif
+            }
+        });
+        return container;
+    }
+
+    template <typename T, JsonSink Sink>
+    void writeJsonParallel(const T& value, Sink& sink, const ParallelOptions& options);
+
+    template <typename T, JsonSink Sink, std::size_t... I>
+    void writeJsonMembersParallel(const T& obj, Sink& sink, const ParallelOptions& options, std::index_sequence<I...>)
+    {
+        constexpr auto& fragments = memberKeyFragments<T>;
+        const auto values         = obj.getMemberValues();
+        ((sink.append(fragments.fragment(I).data(), fragments.fragment(I).size()), writeJsonParallel(std::get<I>(values), sink, options)), ...);
+    }
+
+    // 与 writeJson 输出相同的文本；遇到足够大的容器时各块并行写入各自的缓冲区，再按顺序拼接
+    template <typename T, JsonSink Sink>
+    void writeJsonParallel(const T& value, Sink& sink, const ParallelOptions& options)
+    {
+        if constexpr (ParallelContainer<T>) {
+            const std::size_t count = value.size();
+            if (count < options.minElements) {
+                writeJson(value, sink);
+                return;
+            }
+            const std::size_t chunkCount = options.chunkCount(count);
+            std::vector<std::string> chunks(chunkCount);
+            options.threadPool().parallelFor(count, chunkCount, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                std::string& buffer = chunks[chunk];
+                for (std::size_t i = begin; i < end; ++i) {
+                    if (i != begin) {
+                        buffer.push_back(',');
+                    }
+                    writeJson(value[i], buffer);
+                }
+            });
+            sink.push_back('[');
+            bool first = true;
+            for (const auto& chunk : chunks) {
+                if (chunk.empty()) {
+                    continue;
+                }
+                if (!first) {
+                    sink.push_back(',');
+                }
+                first = false;
+                sink.append(chunk.data(), chunk.size());
+            }
+            sink.push_back(']');
+        }
+        else if constexpr (ForEachable<T> && !is_container<T>::value) {
+            if constexpr (memberCount<T> == 0) {
+                sink.append("{}", 2);
+            }
+            else {
+                writeJsonMembersParallel(value, sink, options, std::make_index_sequence<memberCount<T>>{});
+                sink.push_back('}');
+            }
+        }
+        else {
+            writeJson(value, sink);
+        }
+    }
+
+    template <typename T>
+    void toJsonStringParallel(const T& obj, std::string& out, const ParallelOptions& options = {})
+    {
+        out.clear();
+        writeJsonParallel(obj, out, options);
+    }
+
+    template <typename T>
+    std::string toJsonStringParallel(const T& obj, const ParallelOptions& options = {})
+    {
+        std::string out;
+        writeJsonParallel(obj, out, options);
+        return out;
+    }
+
+    // 并行解码的上下文：整个输入的结构索引只构建一次，用于定位大数组中各元素的边界
+    struct ParallelReadContext
+    {
+        std::string_view               text;
+        std::span<const std::uint32_t> indices;
+        ParallelOptions                options;
+    };
+
+    template <typename T>
+    void readJsonParallel(JsonReader& reader, T& value, const ParallelReadContext& context);
+
+    template <typename T, std::size_t... I>
+    constexpr auto makeMemberParallelReaders(std::index_sequence<I...>)
+    {
+        using Reader = void (*)(JsonReader&, T&, const ParallelReadContext&);
+        return std::array<Reader, sizeof...(I)>{+[](JsonReader& reader, T& obj, const ParallelReadContext& context) { readJsonParallel(reader, std::get<I>(obj.getMemberValues()), context); }...};
+    }
+
+    template <typename T>
+    inline constexpr auto memberParallelReaders = makeMemberParallelReaders<T>(std::make_index_sequence<memberCount<T>>{});
+
+    // 从 reader 当前位置的 '[' 开始，沿结构索引找出各元素的起始位置与其后的 ',' 或 ']' 的位置。
+    // 数组未闭合时返回 false，交给顺序解码报告错误
+    inline bool findJsonArrayElements(const ParallelReadContext& context, std::size_t open, std::vector<std::uint32_t>& starts, std::vector<std::uint32_t>& ends)
+    {
+        const auto indices = context.indices;
+        auto it            = std::lower_bound(indices.begin(), indices.end(), static_cast<std::uint32_t>(open));
+        if (it == indices.end() || *it != open) {
+            return false;
+        }
+        std::size_t depth = 0;
+        bool atStart      = true;
+        for (++it; it != indices.end(); ++it) {
+            const char ch = context.text[*it];
+            if (starts.empty() && ch == ']') {
+                // 空数组
+                ends.push_back(*it);
+                return true;
+            }
+            if (atStart) {
+                starts.push_back(*it);
+                atStart = false;
+            }
+            if (ch == '[' || ch == '{') {
+                ++depth;
+            }
+            else if (ch == ']' || ch == '}') {
+                if (depth == 0) {
+                    ends.push_back(*it);
+                    return true;
+                }
+                --depth;
+            }
+            else if (ch == ',' && depth == 0) {
+                ends.push_back(*it);
+                atStart = true;
+            }
+        }
+        return false;
+    }
+
+    template <ParallelDecodableContainer T>
+    void readJsonArrayParallel(JsonReader& reader, T& value, const ParallelReadContext& context)
+    {
+        const std::size_t open = reader.offset();
+        std::vector<std::uint32_t> starts;
+        std::vector<std::uint32_t> ends;
+        if (!findJsonArrayElements(context, open, starts, ends) || starts.empty() || starts.size() < context.options.minElements) {
+            readJson(reader, value);
+            return;
+        }
+        const std::size_t count = starts.size();
+        value.clear();
+        value.resize(count);
+
+        // 每块只记录自己遇到的第一个错误，最后取输入中最靠前的一个，与顺序解码报告的位置一致
+        struct ChunkError
+        {
+            const char*   message = nullptr;
+            JsonErrorCode code    = JsonErrorCode::Syntax;
+            std::size_t   offset  = 0;
+        };
+        const std::size_t chunkCount = context.options.chunkCount(count);
+        std::vector<ChunkError> errors(chunkCount);
+        context.options.threadPool().parallelFor(count, chunkCount, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+            JsonReader elementReader(context.text);
+            for (std::size_t i = begin; i < end; ++i) {
+                elementReader.seek(starts[i]);
+                readJson(elementReader, value[i]);
+                if (elementReader.ok() && (elementReader.peek(), elementReader.offset() != ends[i])) {
+                    elementReader.fail("expected ',' or ']'");
+                }
+                if (!elementReader.ok()) {
+                    errors[chunk] = ChunkError{ elementReader.errorMessage(), elementReader.errorCode(), elementReader.errorOffset() };
+                    return;
+                }
+            }
+        });
+        for (const auto& error : errors) {
+            if (error.message != nullptr) {
+                reader.seek(error.offset);
+                reader.fail(error.message, error.code);
+                return;
+            }
+        }
+        reader.seek(ends.back());
+        reader.expect(']', "expected ',' or ']'");
+    }
+
+    // 与 readJson 行为一致；遇到足够大的数组时按结构索引切分元素并行解码
+    template <typename T>
+    void readJsonParallel(JsonReader& reader, T& value, const ParallelReadContext& context)
+    {
+        if constexpr (ParallelDecodableContainer<T>) {
+            if (reader.peek() == '[') {
+                readJsonArrayParallel(reader, value, context);
+            }
+            else {
+                readJson(reader, value);
+            }
+        }
+        else if constexpr (ForEachable<T> && !is_container<T>::value) {
+            if (reader.consumeNull() || !reader.expect('{', "expected object", JsonErrorCode::TypeMismatch) || reader.consume('}')) {
+                return;
+            }
+            std::string scratch;
+            do {
+                std::string_view key;
+                if (!reader.readStringView(key, scratch) || !reader.expect(':', "expected ':'")) {
+                    return;
+                }
+                const std::size_t index = findMemberIndex<T>(key);
+                if (index < memberCount<T>) {
+                    memberParallelReaders<T>[index](reader, value, context);
+                }
+                else {
+                    reader.skipValue();
+                }
+            } while (reader.ok() && reader.consume(','));
+            reader.expect('}', "expected ',' or '}'");
+        }
+        else {
+            readJson(reader, value);
+        }
+    }
+
+    // 与 fromJsonString 结果相同，先用 SIMD 构建整个输入的结构索引，再并行解码其中的大数组
+    template <typename T>
+    T fromJsonStringParallel(std::string_view text, const ParallelOptions& options = {})
+    {
+        JsonStructuralIndex index;
+        index.build(text);
+        const ParallelReadContext context{ text, index.indices(), options };
+        T obj{};
+        JsonReader reader(text);
+        readJsonParallel(reader, obj, context);
+        if (reader.ok() && !reader.atEnd()) {
+            reader.fail("unexpected trailing characters");
+        }
+        if (!reader.ok()) {
+            throw JsonParseError(reader.errorMessage(), reader.errorOffset());
+        }
+        return obj;
+    }
+} // namespace RyReflect
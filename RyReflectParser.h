@@ -0,0 +1,376 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description 基于结构索引的JSON解析器：第一阶段用SIMD找出结构字符，第二阶段沿索引构建 JsonValue
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#pragma once
+#include "RyReflect.h"
+#include <cstring>
+#include <memory>
+#include <span>
+
+namespace RyReflect
+{
+    // 64 字节一组的字符分类掩码，第 i 位对应组内第 i 个字节
+    struct JsonBlockMasks
+    {
+        std::uint64_t quote     = 0;
+        std::uint64_t backslash = 0;
+        std::uint64_t op        = 0; // { } [ ] : ,
+        std::uint64_t space     = 0; // 空格 \t \n \r
+    };
+
+#ifdef RYREFLECT_HAS_SSE2
+    inline std::uint64_t jsonEqualMask16(__m128i chunk, char ch)
+    {
+        return static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(ch))));
+    }
+#endif
+
+    inline JsonBlockMasks classifyJsonBlock(const char* block)
+    {
+        JsonBlockMasks masks;
+#if defined(RYREFLECT_HAS_AVX2)
+        for (int i = 0; i < 2; ++i) {
+            const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + i * 32));
+            const auto eq       = [&chunk](char ch) { return _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(ch)); };
+            const auto bits     = [](__m256i mask) { return static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(mask))); };
+            const int shift     = i * 32;
+            masks.quote |= bits(eq('"')) << shift;
+            masks.backslash |= bits(eq('\\')) << shift;
+            masks.op |= bits(_mm256_or_si256(_mm256_or_si256(_mm256_or_si256(eq('{'), eq('}')), _mm256_or_si256(eq('['), eq(']'))), _mm256_or_si256(eq(':'), eq(',')))) << shift;
+            masks.space |= bits(_mm256_or_si256(_mm256_or_si256(eq(' '), eq('\t')), _mm256_or_si256(eq('\n'), eq('\r')))) << shift;
+        }
+#elif defined(RYREFLECT_HAS_SSE2)
+        for (int i = 0; i < 4; ++i) {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i * 16));
+            const int shift     = i * 16;
+            masks.quote |= jsonEqualMask16(chunk, '"') << shift;
+            masks.backslash |= jsonEqualMask16(chunk, '\\') << shift;
+            masks.op |= (jsonEqualMask16(chunk, '{') | jsonEqualMask16(chunk, '}') | jsonEqualMask16(chunk, '[') | jsonEqualMask16(chunk, ']') | jsonEqualMask16(chunk, ':') |
+                         jsonEqualMask16(chunk, ','))
+                        << shift;
+            masks.space |= (jsonEqualMask16(chunk, ' ') | jsonEqualMask16(chunk, '\t') | jsonEqualMask16(chunk, '\n') | jsonEqualMask16(chunk, '\r')) << shift;
+        }
+#else
+        for (int i = 0; i < 64; ++i) {
+            const std::uint64_t bit = std::uint64_t{1} << i;
+            switch (block[i]) {
+            case '"': masks.quote |= bit; break;
+            case '\\': masks.backslash |= bit; break;
+            case '{':
+            case '}':
+            case '[':
+            case ']':
+            case ':':
+            case ',': masks.op |= bit; break;
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r': masks.space |= bit; break;
+            default: break;
+            }
+        }
+#endif
+        return masks;
+    }
+
+    // 前缀异或：结果第 i 位为输入第 0..i 位的异或，用于从引号位置得到字符串内部的掩码
+    inline std::uint64_t prefixXor(std::uint64_t bits)
+    {
+        bits ^= bits << 1;
+        bits ^= bits << 2;
+        bits ^= bits << 4;
+        bits ^= bits << 8;
+        bits ^= bits << 16;
+        bits ^= bits << 32;
+        return bits;
+    }
+
+    // 第一阶段：找出所有结构字符、字符串起始引号和标量（数字、true/false/null）的起始位置
+    // 结果为按顺序排列的字节偏移，字符串内部的字符不会出现在索引中
+    class JsonStructuralIndex
+    {
+    public:
+        void build(std::string_view text)
+        {
+            if (text.size() > std::numeric_limits<std::uint32_t>::max()) {
+                throw JsonParseError("document too large", 0);
+            }
+            // 每个字节最多对应一个索引，按上限分配且不做初始化，缓冲区在多次 build 之间复用
+            if (m_capacity < text.size()) {
+                m_indices  = std::make_unique_for_overwrite<std::uint32_t[]>(text.size());
+                m_capacity = text.size();
+            }
+            std::uint32_t* out = m_indices.get();
+            std::uint64_t escapeCarry   = 0; // 上一组末尾是未配对的反斜杠
+            std::uint64_t inStringCarry = 0; // 上一组结束时仍在字符串内
+            std::uint64_t separatorCarry = 1; // 上一组最后一个字节是分隔符（空白、结构字符或引号）
+            char tail[64];
+            for (std::size_t base = 0; base < text.size(); base += 64) {
+                const char* block = text.data() + base;
+                if (text.size() - base < 64) {
+                    std::memset(tail, ' ', sizeof(tail));
+                    std::memcpy(tail, block, text.size() - base);
+                    block = tail;
+                }
+                const auto masks = classifyJsonBlock(block);
+
+                // 被转义的字符：逐个处理反斜杠，每个未被转义的反斜杠转义其后一个字符
+                std::uint64_t escaped   = escapeCarry;
+                std::uint64_t backslash = masks.backslash & ~escapeCarry;
+                escapeCarry             = 0;
+                while (backslash != 0) {
+                    const int bit = std::countr_zero(backslash);
+                    if (bit == 63) {
+                        escapeCarry = 1;
+                        break;
+                    }
+                    escaped |= std::uint64_t{1} << (bit + 1);
+                    backslash &= ~(std::uint64_t{3} << bit);
+                }
+
+                const std::uint64_t quotes   = masks.quote & ~escaped;
+                const std::uint64_t inString = prefixXor(quotes) ^ inStringCarry;
+                inStringCarry                = static_cast<std::uint64_t>(static_cast<std::int64_t>(inString) >> 63);
+
+                const std::uint64_t separators = masks.op | masks.space | quotes;
+                const std::uint64_t scalars    = ~separators & ~inString & ~masks.space;
+                const std::uint64_t follows    = (separators << 1) | separatorCarry;
+                separatorCarry                 = separators >> 63;
+
+                std::uint64_t structurals = (masks.op & ~inString) | (quotes & inString) | (scalars & follows);
+                if (text.size() - base < 64) {
+                    structurals &= (std::uint64_t{1} << (text.size() - base)) - 1;
+                }
+                while (structurals != 0) {
+                    *out++ = static_cast<std::uint32_t>(base + static_cast<std::size_t>(std::countr_zero(structurals)));
+                    structurals &= structurals - 1;
+                }
+            }
+            m_size = static_cast<std::size_t>(out - m_indices.get());
+            if (inStringCarry != 0) {
+                throw JsonParseError("unterminated string", text.size());
+            }
+        }
+
+        std::span<const std::uint32_t> indices() const { return std::span<const std::uint32_t>(m_indices.get(), m_size); }
+
+    private:
+        std::unique_ptr<std::uint32_t[]> m_indices;
+        std::size_t                      m_capacity = 0;
+        std::size_t                      m_size     = 0;
+    };
+
+    // 第二阶段：沿结构索引递归构建 JsonValue；字符串和数字的解码复用 JsonReader
+    class JsonIndexedParser
+    {
+    public:
+        static constexpr std::size_t maxDepth = 1024;
+
+        JsonIndexedParser(std::string_view text, std::span<const std::uint32_t> indices)
+            : m_text(text)
+            , m_indices(indices)
+            , m_reader(text)
+        { }
+
+        JsonValue parseDocument()
+        {
+            JsonValue value = parseValue(0);
+            if (m_next != m_indices.size()) {
+                fail("unexpected trailing characters");
+            }
+            return value;
+        }
+
+    private:
+        [[noreturn]] void fail(const char* message)
+        {
+            const std::size_t offset = m_next < m_indices.size() ? m_indices[m_next] : m_text.size();
+            throw JsonParseError(message, offset);
+        }
+
+        [[noreturn]] void failReader() { throw JsonParseError(m_reader.errorMessage(), m_reader.errorOffset()); }
+
+        char peek() const { return m_next < m_indices.size() ? m_text[m_indices[m_next]] : '\0'; }
+
+        bool consume(char ch)
+        {
+            if (peek() == ch) {
+                ++m_next;
+                return true;
+            }
+            return false;
+        }
+
+        // 标量之后必须紧跟分隔符或输入结束，否则是类似 truex、12ab 的非法写法
+        void checkScalarEnd()
+        {
+            const auto end = m_reader.offset();
+            if (end < m_text.size()) {
+                const char ch = m_text[end];
+                if (ch != ' ' && ch != '\t' && ch != '\n' && ch != '\r' && ch != ',' && ch != ':' && ch != '}' && ch != ']') {
+                    fail("invalid literal");
+                }
+            }
+        }
+
+        std::string parseString()
+        {
+            std::string str;
+            m_reader.seek(m_indices[m_next++]);
+            if (!m_reader.readString(str)) {
+                failReader();
+            }
+            return str;
+        }
+
+        JsonValue parseNumber()
+        {
+            m_reader.seek(m_indices[m_next++]);
+            std::string_view token;
+            if (!m_reader.readNumberToken(token)) {
+                failReader();
+            }
+            checkScalarEnd();
+            if (token.find_first_of(".eE") == std::string_view::npos) {
+                // 整数按 int -> int64 -> uint64 依次尝试，超出64位范围才退化为 double
+                std::int64_t integer = 0;
+                const auto last      = token.data() + token.size();
+                if (const auto result = std::from_chars(token.data(), last, integer); result.ec == std::errc() && result.ptr == last) {
+                    if (std::in_range<int>(integer)) {
+                        return JsonValue(static_cast<int>(integer));
+                    }
+                    return toJsonNumber(integer);
+                }
+#ifndef RY_USE_QT
+                std::uint64_t unsignedInteger = 0;
+                if (const auto result = std::from_chars(token.data(), last, unsignedInteger); result.ec == std::errc() && result.ptr == last) {
+                    return JsonValue(unsignedInteger);
+                }
+#endif
+            }
+            double number = 0;
+            m_reader.seek(m_indices[m_next - 1]);
+            if (!m_reader.readNumber(number)) {
+                failReader();
+            }
+            return JsonValue(number);
+        }
+
+        JsonValue parseLiteral()
+        {
+            m_reader.seek(m_indices[m_next++]);
+            JsonValue value;
+            if (m_reader.consumeNull()) {
+                value = JsonValue(nullptr);
+            }
+            else {
+                bool flag = false;
+                if (!m_reader.readBool(flag)) {
+                    failReader();
+                }
+                value = JsonValue(flag);
+            }
+            checkScalarEnd();
+            return value;
+        }
+
+        JsonValue parseValue(std::size_t depth)
+        {
+            if (depth > maxDepth) {
+                fail("document too deep");
+            }
+            switch (peek()) {
+            case '{': {
+                ++m_next;
+                JsonObject object;
+                if (consume('}')) {
+                    return object;
+                }
+                do {
+                    if (peek() != '"') {
+                        fail("expected string");
+                    }
+                    std::string key = parseString();
+                    if (!consume(':')) {
+                        fail("expected ':'");
+                    }
+                    JsonValue member = parseValue(depth + 1);
+#ifdef RY_USE_QT
+                    object.insert(QString::fromStdString(key), member);
+#else
+                    object.insert(std::move(key), std::move(member));
+#endif
+                } while (consume(','));
+                if (!consume('}')) {
+                    fail("expected ',' or '}'");
+                }
+                return object;
+            }
+            case '[': {
+                ++m_next;
+                JsonArray array;
+                if (consume(']')) {
+                    return array;
+                }
+                do {
+                    array.push_back(parseValue(depth + 1));
+                } while (consume(','));
+                if (!consume(']')) {
+                    fail("expected ',' or ']'");
+                }
+                return array;
+            }
+            case '"': {
+#ifdef RY_USE_QT
+                return QJsonValue(QString::fromStdString(parseString()));
+#else
+                return JsonValue(parseString());
+#endif
+            }
+            case 't':
+            case 'f':
+            case 'n': return parseLiteral();
+            case '\0': fail("unexpected end of input");
+            default:
+                if (peek() == '-' || (peek() >= '0' && peek() <= '9')) {
+                    return parseNumber();
+                }
+                fail("unexpected character");
+            }
+        }
+
+        std::string_view                  m_text;
+        std::span<const std::uint32_t>    m_indices;
+        JsonReader                        m_reader;
+        std::size_t                       m_next = 0;
+    };
+
+    // 解析JSON文本为 JsonValue，不依赖 QJsonDocument，格式错误时抛出 JsonParseError
+    inline JsonValue parseJson(std::string_view text)
+    {
+        JsonStructuralIndex index;
+        index.build(text);
+        return JsonIndexedParser(text, index.indices()).parseDocument();
+    }
+
+    // 解析JSON文本为 JsonObject，可以直接交给 RY_REFLECTABLE 生成的 fromJson
+    inline JsonObject parseJsonObject(std::string_view text)
+    {
+        JsonValue value = parseJson(text);
+#ifdef RY_USE_QT
+        if (!value.isObject()) {
+            throw JsonParseError("expected object", 0);
+        }
+        return value.toObject();
+#else
+        auto* object = std::get_if<JsonObject>(&value.value);
+        if (object == nullptr) {
+            throw JsonParseError("expected object", 0);
+        }
+        return std::move(*object);
+#endif
+    }
+} // namespace RyReflect
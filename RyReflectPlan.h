@@ -0,0 +1,351 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description 表驱动的JSON编解码：每个反射类型对应一张成员操作表，由同一个解释循环执行编码和解码
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#pragma once
+#include "RyReflect.h"
+#include <cstddef>
+#include <cstring>
+
+namespace RyReflect
+{
+    // toJsonString/fromJsonString 为每个类型的每个成员展开一段内联代码；这里的 *ByPlan 版本把类型描述成一张表，
+    // 所有类型共用同一个解释循环，每个成员多一次分派，但代码体积基本不随类型和成员数量增长。
+    // 两者的输出和解析行为完全一致，可以互相替换、对比测试
+    enum class PlanOp : std::uint8_t
+    {
+        Bool,
+        Int8,
+        Int16,
+        Int32,
+        Int64,
+        UInt8,
+        UInt16,
+        UInt32,
+        UInt64,
+        Float,
+        Double,
+        String,
+        Object, // 嵌套的反射类型，由 nested 给出它的表
+        Custom, // 其他类型（容器、Qt 字符串等），通过 write/read 编解码，容器的元素仍按表处理
+    };
+
+    struct SerializerPlan;
+
+    struct PlanField
+    {
+        PlanOp           op;
+        std::uint32_t    offset; // 成员相对对象起始地址的偏移
+        std::string_view key;    // 预先转义的键片段，包含前导的 { 或 ,
+        const SerializerPlan& (*nested)();
+        void (*write)(const void* field, std::string& out);
+        void (*read)(JsonReader& reader, void* field);
+    };
+
+    struct SerializerPlan
+    {
+        const PlanField* fields;
+        std::size_t      count;
+        std::size_t (*find)(std::string_view key); // 键名到下标，找不到时返回 count
+    };
+
+    template <typename T>
+    const SerializerPlan& serializerPlan();
+
+    inline void writeByPlan(const SerializerPlan& plan, const std::byte* object, std::string& out);
+    inline void readByPlan(const SerializerPlan& plan, JsonReader& reader, std::byte* object);
+
+    // 按表编解码任意类型的值：反射类型进入解释循环，容器逐个元素递归，其余类型（包括 std::string、QString、QByteArray）
+    // 交给 writeJson/readJson。字符串类型也有 begin/end，必须在容器之前排除，与 writeJson 的分派顺序一致
+    template <typename T>
+    void writePlanned(const T& value, std::string& out)
+    {
+        if constexpr (ForEachable<T>) {
+            writeByPlan(serializerPlan<T>(), reinterpret_cast<const std::byte*>(&value), out);
+        }
+        else if constexpr (is_container<T>::value && !is_string_like_v<T>) {
+            out.push_back('[');
+            bool first = true;
+            for (const auto& item : value) {
+                if (!first) {
+                    out.push_back(',');
+                }
+                first = false;
+                writePlanned(item, out);
+            }
+            out.push_back(']');
+        }
+        else {
+            writeJson(value, out);
+        }
+    }
+
+    template <typename T>
+    void readPlanned(JsonReader& reader, T& value)
+    {
+        if constexpr (ForEachable<T>) {
+            if (!reader.consumeNull()) {
+                readByPlan(serializerPlan<T>(), reader, reinterpret_cast<std::byte*>(&value));
+            }
+        }
+        else if constexpr (is_container<T>::value && !is_string_like_v<T>) {
+            if (reader.consumeNull() || !reader.expect('[', "expected array", JsonErrorCode::TypeMismatch) || !reader.enter()) {
+                return;
+            }
+            if constexpr (ReusableContainer<T>) {
+                auto it = value.begin();
+                if (!reader.consume(']')) {
+                    do {
+                        readPlanned(reader, reuseContainerElement(value, it));
+                    } while (reader.ok() && reader.consume(','));
+                    reader.expect(']', "expected ',' or ']'");
+                }
+                value.erase(it, value.end());
+            }
+            else {
+                value.clear();
+                if (!reader.consume(']')) {
+                    do {
+                        typename T::value_type item{};
+                        readPlanned(reader, item);
+                        value.insert(value.end(), std::move(item));
+                    } while (reader.ok() && reader.consume(','));
+                    reader.expect(']', "expected ',' or ']'");
+                }
+            }
+            reader.leave();
+        }
+        else {
+            readJson(reader, value);
+        }
+    }
+
+    template <typename M>
+    constexpr PlanOp planOp()
+    {
+        if constexpr (std::is_same_v<M, bool>) {
+            return PlanOp::Bool;
+        }
+        else if constexpr (std::is_integral_v<M>) {
+            constexpr PlanOp ops[2][4] = {{PlanOp::UInt8, PlanOp::UInt16, PlanOp::UInt32, PlanOp::UInt64}, {PlanOp::Int8, PlanOp::Int16, PlanOp::Int32, PlanOp::Int64}};
+            return ops[std::is_signed_v<M>][std::bit_width(sizeof(M)) - 1];
+        }
+        else if constexpr (std::is_same_v<M, float>) {
+            return PlanOp::Float;
+        }
+        else if constexpr (std::is_same_v<M, double>) {
+            return PlanOp::Double;
+        }
+        else if constexpr (std::is_same_v<M, std::string>) {
+            return PlanOp::String;
+        }
+        else if constexpr (ForEachable<M>) {
+            return PlanOp::Object;
+        }
+        else {
+            return PlanOp::Custom;
+        }
+    }
+
+    // Object 和 Custom 成员用到的函数按成员类型实例化，同一类型的成员共用
+    template <typename M>
+    const SerializerPlan& nestedSerializerPlan()
+    {
+        return serializerPlan<M>();
+    }
+
+    template <typename M>
+    void writePlannedField(const void* field, std::string& out)
+    {
+        writePlanned(*static_cast<const M*>(field), out);
+    }
+
+    template <typename M>
+    void readPlannedField(JsonReader& reader, void* field)
+    {
+        readPlanned(reader, *static_cast<M*>(field));
+    }
+
+    template <typename M>
+    constexpr PlanField makePlanField(std::uint32_t offset, std::string_view key)
+    {
+        PlanField field{ planOp<M>(), offset, key, nullptr, nullptr, nullptr };
+        if constexpr (planOp<M>() == PlanOp::Object) {
+            field.nested = &nestedSerializerPlan<M>;
+        }
+        else if constexpr (planOp<M>() == PlanOp::Custom) {
+            field.write = &writePlannedField<M>;
+            field.read  = &readPlannedField<M>;
+        }
+        return field;
+    }
+
+    // 偏移从一个默认构造的对象上量出，成员偏移对非标准布局类型不是常量表达式
+    template <typename T, std::size_t... I>
+    std::array<PlanField, sizeof...(I)> buildPlanFields(std::index_sequence<I...>)
+    {
+        const T sample{};
+        const auto* base  = reinterpret_cast<const std::byte*>(&sample);
+        [[maybe_unused]] const auto offset = [base](std::size_t index) {
+            return static_cast<std::uint32_t>(static_cast<const std::byte*>(fieldDescriptors<T>[index].constAddress(base)) - base);
+        };
+        return { makePlanField<MemberType<T, I>>(offset(I), memberKeyFragments<T>.fragment(I))... };
+    }
+
+    // 类型 T 的操作表，第一次使用时构建。嵌套类型的表通过 nested 按需取得，自引用的类型（如树节点）也可以使用
+    template <typename T>
+    const SerializerPlan& serializerPlan()
+    {
+        static const auto fields         = buildPlanFields<T>(std::make_index_sequence<memberCount<T>>{});
+        static const SerializerPlan plan = { fields.data(), fields.size(), +[](std::string_view key) { return findMemberIndex<T>(key); } };
+        return plan;
+    }
+
+    template <typename V>
+    V loadPlanValue(const std::byte* field)
+    {
+        V value;
+        std::memcpy(&value, field, sizeof(V));
+        return value;
+    }
+
+    // 整数和浮点成员按宽度读写，memcpy 避免 long 与 long long 等同宽类型之间的别名问题
+    template <typename V>
+    void readPlanNumber(JsonReader& reader, std::byte* field)
+    {
+        V value = loadPlanValue<V>(field);
+        if (reader.readNumber(value)) {
+            std::memcpy(field, &value, sizeof(V));
+        }
+    }
+
+    inline void writeByPlan(const SerializerPlan& plan, const std::byte* object, std::string& out)
+    {
+        if (plan.count == 0) {
+            out.append("{}", 2);
+            return;
+        }
+        for (std::size_t i = 0; i < plan.count; ++i) {
+            const PlanField& field = plan.fields[i];
+            const std::byte* value = object + field.offset;
+            out.append(field.key.data(), field.key.size());
+            switch (field.op) {
+            case PlanOp::Bool: {
+                if (loadPlanValue<bool>(value)) {
+                    out.append("true", 4);
+                }
+                else {
+                    out.append("false", 5);
+                }
+                break;
+            }
+            case PlanOp::Int8: writeJsonNumber(out, loadPlanValue<std::int8_t>(value)); break;
+            case PlanOp::Int16: writeJsonNumber(out, loadPlanValue<std::int16_t>(value)); break;
+            case PlanOp::Int32: writeJsonNumber(out, loadPlanValue<std::int32_t>(value)); break;
+            case PlanOp::Int64: writeJsonNumber(out, loadPlanValue<std::int64_t>(value)); break;
+            case PlanOp::UInt8: writeJsonNumber(out, loadPlanValue<std::uint8_t>(value)); break;
+            case PlanOp::UInt16: writeJsonNumber(out, loadPlanValue<std::uint16_t>(value)); break;
+            case PlanOp::UInt32: writeJsonNumber(out, loadPlanValue<std::uint32_t>(value)); break;
+            case PlanOp::UInt64: writeJsonNumber(out, loadPlanValue<std::uint64_t>(value)); break;
+            case PlanOp::Float: writeJsonNumber(out, loadPlanValue<float>(value)); break;
+            case PlanOp::Double: writeJsonNumber(out, loadPlanValue<double>(value)); break;
+            case PlanOp::String: writeJsonString(out, *reinterpret_cast<const std::string*>(value)); break;
+            case PlanOp::Object: writeByPlan(field.nested(), value, out); break;
+            case PlanOp::Custom: field.write(value, out); break;
+            }
+        }
+        out.push_back('}');
+    }
+
+    inline void readByPlan(const SerializerPlan& plan, JsonReader& reader, std::byte* object)
+    {
+        if (!reader.expect('{', "expected object", JsonErrorCode::TypeMismatch) || !reader.enter()) {
+            return;
+        }
+        if (reader.consume('}')) {
+            reader.leave();
+            return;
+        }
+        std::string scratch;
+        do {
+            std::string_view key;
+            if (!reader.readStringView(key, scratch) || !reader.expect(':', "expected ':'")) {
+                break;
+            }
+            const std::size_t index = plan.find(key);
+            if (index >= plan.count) {
+                reader.skipValue();
+                continue;
+            }
+            const PlanField& field = plan.fields[index];
+            std::byte* value       = object + field.offset;
+            if (reader.consumeNull()) {
+                continue;
+            }
+            switch (field.op) {
+            case PlanOp::Bool: {
+                bool flag = loadPlanValue<bool>(value);
+                if (reader.readBool(flag)) {
+                    std::memcpy(value, &flag, sizeof(bool));
+                }
+                break;
+            }
+            case PlanOp::Int8: readPlanNumber<std::int8_t>(reader, value); break;
+            case PlanOp::Int16: readPlanNumber<std::int16_t>(reader, value); break;
+            case PlanOp::Int32: readPlanNumber<std::int32_t>(reader, value); break;
+            case PlanOp::Int64: readPlanNumber<std::int64_t>(reader, value); break;
+            case PlanOp::UInt8: readPlanNumber<std::uint8_t>(reader, value); break;
+            case PlanOp::UInt16: readPlanNumber<std::uint16_t>(reader, value); break;
+            case PlanOp::UInt32: readPlanNumber<std::uint32_t>(reader, value); break;
+            case PlanOp::UInt64: readPlanNumber<std::uint64_t>(reader, value); break;
+            case PlanOp::Float: readPlanNumber<float>(reader, value); break;
+            case PlanOp::Double: readPlanNumber<double>(reader, value); break;
+            case PlanOp::String: reader.readString(*reinterpret_cast<std::string*>(value)); break;
+            case PlanOp::Object: readByPlan(field.nested(), reader, value); break;
+            case PlanOp::Custom: field.read(reader, value); break;
+            }
+        } while (reader.ok() && reader.consume(','));
+        reader.expect('}', "expected ',' or '}'");
+        reader.leave();
+    }
+
+    // 与 toJsonString 输出相同的文本
+    template <typename T>
+    void toJsonStringByPlan(const T& obj, std::string& out)
+    {
+        out.clear();
+        writePlanned(obj, out);
+    }
+
+    template <typename T>
+    std::string toJsonStringByPlan(const T& obj)
+    {
+        std::string out;
+        writePlanned(obj, out);
+        return out;
+    }
+
+    // 与 fromJsonInto 的行为相同：文本中没有的成员保留原值，格式错误时抛出 JsonParseError
+    template <typename T>
+    void fromJsonIntoByPlan(T& obj, std::string_view text)
+    {
+        JsonReader reader(text);
+        readPlanned(reader, obj);
+        if (reader.ok() && !reader.atEnd()) {
+            reader.fail("unexpected trailing characters");
+        }
+        if (!reader.ok()) {
+            throw JsonParseError(reader.errorMessage(), reader.errorOffset());
+        }
+    }
+
+    template <typename T>
+    T fromJsonStringByPlan(std::string_view text)
+    {
+        T obj{};
+        fromJsonIntoByPlan(obj, text);
+        return obj;
+    }
+} // namespace RyReflect
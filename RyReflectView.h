@@ -0,0 +1,322 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description 可原地读取的二进制布局，按需解码成员，无需解析步骤
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#pragma once
+#include "RyReflectBinary.h"
+
+namespace RyReflect
+{
+    // 视图布局（所有整数均为小端）：
+    // - 反射类型：N 个 uint32 偏移（相对于对象起始位置），随后是各成员的数据
+    // - bool 占一个字节，其他算术类型为 sizeof(T) 字节的定长值
+    // - 字符串：uint32 长度加 UTF-8 字节
+    // - 元素为算术类型的容器：uint32 个数加紧密排列的定长元素
+    // - 其他容器：uint32 个数、个数个 uint32 偏移（相对于容器起始位置），随后是各元素
+    // 任意成员都可以通过偏移表 O(1) 定位，因此 View 可以直接构建在 mmap 得到的内存上
+
+    template <typename T>
+    inline constexpr std::size_t viewScalarSize = std::is_same_v<T, bool> ? 1 : sizeof(T);
+
+    inline void patchViewOffset(BinaryBuffer& out, std::size_t slot, std::size_t offset)
+    {
+        if (offset > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::length_error("RyReflect: view layout exceeds 4 GiB");
+        }
+        const auto value = static_cast<std::uint32_t>(offset);
+        BinaryBuffer bytes;
+        writeLittleEndian(bytes, value);
+        std::memcpy(out.data() + slot, bytes.data(), sizeof(value));
+    }
+
+    // 写入字符串长度或容器元素个数，超出 uint32 时抛出 std::length_error 而不是静默截断
+    inline void writeViewLength(BinaryBuffer& out, std::size_t length)
+    {
+        if (length > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::length_error("RyReflect: view length exceeds 4 GiB");
+        }
+        writeLittleEndian(out, static_cast<std::uint32_t>(length));
+    }
+
+    // 以视图布局追加写入值
+    template <typename T>
+    void writeView(const T& value, BinaryBuffer& out)
+    {
+        if constexpr (std::is_same_v<T, std::string>) {
+            writeViewLength(out, value.size());
+            writeBinaryBytes(out, value.data(), value.size());
+        }
+#ifdef RY_USE_QT
+        else if constexpr (std::is_same_v<T, QString>) {
+            writeView(value.toUtf8(), out);
+        }
+        else if constexpr (std::is_same_v<T, QByteArray>) {
+            writeViewLength(out, static_cast<std::size_t>(value.size()));
+            writeBinaryBytes(out, value.constData(), static_cast<std::size_t>(value.size()));
+        }
+#endif
+        else if constexpr (std::is_same_v<T, bool>) {
+            out.push_back(static_cast<std::byte>(value ? 1 : 0));
+        }
+        else if constexpr (std::is_arithmetic_v<T>) {
+            writeLittleEndian(out, value);
+        }
+        else if constexpr (is_container<T>::value) {
+            using E           = typename T::value_type;
+            const auto start = out.size();
+            const auto count = static_cast<std::size_t>(std::distance(value.begin(), value.end()));
+            writeViewLength(out, count);
+            if constexpr (std::is_arithmetic_v<E>) {
+                for (const auto& item : value) {
+                    writeView(item, out);
+                }
+            }
+            else {
+                const auto table = out.size();
+                out.resize(table + count * sizeof(std::uint32_t));
+                std::size_t index = 0;
+                for (const auto& item : value) {
+                    patchViewOffset(out, table + index++ * sizeof(std::uint32_t), out.size() - start);
+                    writeView(item, out);
+                }
+            }
+        }
+        else if constexpr (ForEachable<T>) {
+            const auto start = out.size();
+            out.resize(start + memberCount<T> * sizeof(std::uint32_t));
+            std::size_t index = 0;
+            forEach(value, [&out, &index, start](const auto&, const auto& member) {
+                patchViewOffset(out, start + index++ * sizeof(std::uint32_t), out.size() - start);
+                writeView(member, out);
+            });
+        }
+        else {
+            static_assert(always_false<T>, "Unsupported type in writeView");
+        }
+    }
+
+    // 生成视图布局的数据，可以直接写入文件供之后 mmap 读取
+    template <ForEachable T>
+    void toViewBuffer(const T& obj, BinaryBuffer& out)
+    {
+        out.clear();
+        writeView(obj, out);
+    }
+
+    template <ForEachable T>
+    BinaryBuffer toViewBuffer(const T& obj)
+    {
+        BinaryBuffer out;
+        writeView(obj, out);
+        return out;
+    }
+
+    // 从视图数据的 pos 处读取小端定长值，越界时抛出 BinaryDecodeError
+    template <typename T>
+    T loadViewScalar(std::span<const std::byte> data, std::size_t pos)
+    {
+        if (pos > data.size() || data.size() - pos < viewScalarSize<T>) {
+            throw BinaryDecodeError("view access out of range", pos);
+        }
+        if constexpr (std::is_same_v<T, bool>) {
+            return data[pos] != std::byte{0};
+        }
+        else {
+            T value;
+            BinaryReader reader(data.subspan(pos, sizeof(T)));
+            reader.readLittleEndian(value);
+            return value;
+        }
+    }
+
+    inline std::span<const std::byte> viewSubspan(std::span<const std::byte> data, std::size_t offset)
+    {
+        if (offset > data.size()) {
+            throw BinaryDecodeError("view offset out of range", offset);
+        }
+        return data.subspan(offset);
+    }
+
+    template <ForEachable T>
+    class View;
+
+    template <typename E>
+    class ArrayView;
+
+    // 成员在视图中的访问类型：算术类型按值返回，字符串返回 std::string_view，嵌套对象和容器返回子视图
+    template <typename T>
+    auto loadView(std::span<const std::byte> data)
+    {
+        if constexpr (std::is_same_v<T, std::string>) {
+            const auto size = loadViewScalar<std::uint32_t>(data, 0);
+            if (data.size() - sizeof(std::uint32_t) < size) {
+                throw BinaryDecodeError("view string out of range", 0);
+            }
+            return std::string_view(reinterpret_cast<const char*>(data.data()) + sizeof(std::uint32_t), size);
+        }
+#ifdef RY_USE_QT
+        else if constexpr (std::is_same_v<T, QString> || std::is_same_v<T, QByteArray>) {
+            const auto str = loadView<std::string>(data);
+            if constexpr (std::is_same_v<T, QString>) {
+                return QString::fromUtf8(str.data(), static_cast<qsizetype>(str.size()));
+            }
+            else {
+                return QByteArray::fromRawData(str.data(), static_cast<qsizetype>(str.size()));
+            }
+        }
+#endif
+        else if constexpr (std::is_arithmetic_v<T>) {
+            return loadViewScalar<T>(data, 0);
+        }
+        else if constexpr (is_container<T>::value) {
+            return ArrayView<typename T::value_type>(data);
+        }
+        else if constexpr (ForEachable<T>) {
+            return View<T>(data);
+        }
+        else {
+            static_assert(always_false<T>, "Unsupported type in loadView");
+        }
+    }
+
+    // 把视图访问结果还原为完整的值
+    template <typename T, typename V>
+    void materializeView(const V& view, T& value)
+    {
+        if constexpr (std::is_same_v<T, std::string>) {
+            value.assign(view);
+        }
+#ifdef RY_USE_QT
+        else if constexpr (std::is_same_v<T, QByteArray>) {
+            // 视图中的 QByteArray 直接引用原始数据，这里需要深拷贝
+            value = QByteArray(view.constData(), view.size());
+        }
+#endif
+        else if constexpr (is_container<T>::value && !std::is_same_v<T, std::remove_cvref_t<V>>) {
+            value.clear();
+            for (std::size_t i = 0; i < view.size(); ++i) {
+                typename T::value_type item{};
+                materializeView(view[i], item);
+                value.insert(value.end(), std::move(item));
+            }
+        }
+        else if constexpr (ForEachable<T> && !std::is_same_v<T, std::remove_cvref_t<V>>) {
+            value = view.load();
+        }
+        else {
+            value = view;
+        }
+    }
+
+    // 元素序列的只读视图
+    template <typename E>
+    class ArrayView
+    {
+    public:
+        ArrayView() = default;
+        explicit ArrayView(std::span<const std::byte> data)
+            : m_data(data)
+            , m_size(loadViewScalar<std::uint32_t>(data, 0))
+        { }
+
+        std::size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+        auto operator[](std::size_t index) const
+        {
+            if (index >= m_size) {
+                throw BinaryDecodeError("view index out of range", index);
+            }
+            if constexpr (std::is_arithmetic_v<E>) {
+                return loadViewScalar<E>(m_data, sizeof(std::uint32_t) + index * viewScalarSize<E>);
+            }
+            else {
+                const auto offset = loadViewScalar<std::uint32_t>(m_data, sizeof(std::uint32_t) * (index + 1));
+                return loadView<E>(viewSubspan(m_data, offset));
+            }
+        }
+
+        class Iterator
+        {
+        public:
+            using difference_type = std::ptrdiff_t;
+            using value_type      = decltype(std::declval<const ArrayView&>()[0]);
+
+            Iterator() = default;
+            Iterator(const ArrayView* view, std::size_t index)
+                : m_view(view)
+                , m_index(index)
+            { }
+
+            value_type operator*() const { return (*m_view)[m_index]; }
+            Iterator& operator++()
+            {
+                ++m_index;
+                return *this;
+            }
+            Iterator operator++(int)
+            {
+                auto copy = *this;
+                ++m_index;
+                return copy;
+            }
+            bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+
+        private:
+            const ArrayView* m_view  = nullptr;
+            std::size_t      m_index = 0;
+        };
+
+        Iterator begin() const { return Iterator(this, 0); }
+        Iterator end() const { return Iterator(this, m_size); }
+
+    private:
+        std::span<const std::byte> m_data;
+        std::size_t                m_size = 0;
+    };
+
+    // 反射类型的只读视图：构造时不做任何解析，访问成员时才按偏移表解码
+    template <ForEachable T>
+    class View
+    {
+    public:
+        View() = default;
+        explicit View(std::span<const std::byte> data)
+            : m_data(data)
+        { }
+
+        template <std::size_t I>
+        auto get() const
+        {
+            static_assert(I < memberCount<T>, "Member index out of range");
+            const auto offset = loadViewScalar<std::uint32_t>(m_data, I * sizeof(std::uint32_t));
+            return loadView<MemberType<T, I>>(viewSubspan(m_data, offset));
+        }
+
+        template <FixedString Name>
+        auto get() const
+        {
+            return get<memberIndex<T, Name>()>();
+        }
+
+        // 解码出完整的对象
+        T load() const
+        {
+            T obj{};
+            loadMembers(obj, std::make_index_sequence<memberCount<T>>{});
+            return obj;
+        }
+
+    private:
+        template <std::size_t... I>
+        void loadMembers(T& obj, std::index_sequence<I...>) const
+        {
+            auto values = obj.getMemberValues();
+            (materializeView(get<I>(), std::get<I>(values)), ...);
+        }
+
+        std::span<const std::byte> m_data;
+    };
+} // namespace RyReflect
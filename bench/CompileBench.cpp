@@ -0,0 +1,269 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description 编译耗时和目标文件体积基准：生成 N 个各有 M 个成员的反射结构体，分别测量各后端的前端耗时、模板实例化数量和目标文件大小
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef RYREFLECT_BENCH_CXX
+#error "RYREFLECT_BENCH_CXX must name the compiler used for the benchmark"
+#endif
+#ifndef RYREFLECT_BENCH_SOURCE_DIR
+#error "RYREFLECT_BENCH_SOURCE_DIR must point to the directory containing RyReflect.h"
+#endif
+// 额外的编译参数，启用 Qt 时由 CMake 传入 RY_USE_QT 和 Qt 的头文件目录
+#ifndef RYREFLECT_BENCH_FLAGS
+#define RYREFLECT_BENCH_FLAGS ""
+#endif
+
+namespace
+{
+    constexpr int repetitions = 3;
+
+    // none 只包含 RY_REFLECTABLE 本身，其余后端在此基础上为每个类型 ODR 使用一对编解码函数
+    enum class Backend
+    {
+        None,
+        Json,
+        Text,
+        Plan,
+        Binary,
+    };
+
+    const char* backendName(Backend backend)
+    {
+        switch (backend) {
+        case Backend::None:
+            return "none";
+        case Backend::Json:
+#ifdef RYREFLECT_BENCH_QT
+            return "json_qt";
+#else
+            return "json";
+#endif
+        case Backend::Text:
+            return "text";
+        case Backend::Plan:
+            return "plan";
+        case Backend::Binary:
+            return "binary";
+        }
+        return "";
+    }
+
+    struct Options
+    {
+        bool json = false;
+        std::vector<int> structs{10, 50};
+        std::vector<int> members{8, 32};
+    };
+
+    struct Result
+    {
+        Backend backend            = Backend::None;
+        int structs                = 0;
+        int members                = 0;
+        double frontendMillis      = 0;
+        double compileMillis       = 0;
+        long long instantiations   = -1;
+        std::uintmax_t objectBytes = 0;
+    };
+
+    // 成员类型轮流取 int、double、std::string、std::vector<int>，覆盖标量、字符串和容器的编解码路径
+    std::string generateSource(Backend backend, int structs, int members)
+    {
+        static const char* types[] = {"int", "double", "std::string", "std::vector<int>"};
+        std::ostringstream out;
+        out << "#include \"" << (std::filesystem::path(RYREFLECT_BENCH_SOURCE_DIR) / "RyReflect.h").generic_string() << "\"\n";
+        if (backend == Backend::Plan) {
+            out << "#include \"" << (std::filesystem::path(RYREFLECT_BENCH_SOURCE_DIR) / "RyReflectPlan.h").generic_string() << "\"\n";
+        }
+        if (backend == Backend::Binary) {
+            out << "#include \"" << (std::filesystem::path(RYREFLECT_BENCH_SOURCE_DIR) / "RyReflectBinary.h").generic_string() << "\"\n";
+        }
+        out << "namespace bench {\n";
+        for (int s = 0; s < structs; ++s) {
+            out << "struct S" << s << " {\n";
+            for (int m = 0; m < members; ++m) {
+                out << "    " << types[m % 4] << " m_f" << m << "{};\n";
+            }
+            out << "    RY_REFLECTABLE(S" << s;
+            for (int m = 0; m < members; ++m) {
+                out << ", m_f" << m;
+            }
+            out << ")\n};\n";
+            switch (backend) {
+            case Backend::None:
+                break;
+            case Backend::Json:
+                out << "S" << s << " roundTrip" << s << "(const S" << s << "& v) { return S" << s << "::fromJson(v.toJson()); }\n";
+                break;
+            case Backend::Text:
+                out << "S" << s << " roundTrip" << s << "(const S" << s << "& v) { return RyReflect::fromJsonString<S" << s << ">(RyReflect::toJsonString(v)); }\n";
+                break;
+            case Backend::Plan:
+                out << "S" << s << " roundTrip" << s << "(const S" << s << "& v) { return RyReflect::fromJsonStringByPlan<S" << s << ">(RyReflect::toJsonStringByPlan(v)); }\n";
+                break;
+            case Backend::Binary:
+                out << "S" << s << " roundTrip" << s << "(const S" << s << "& v) { return RyReflect::fromBinary<S" << s << ">(RyReflect::toBinary(v)); }\n";
+                break;
+            }
+        }
+        out << "}\n";
+        return out.str();
+    }
+
+    std::string quoted(const std::filesystem::path& path)
+    {
+        return "\"" + path.string() + "\"";
+    }
+
+    // 运行命令，返回多次运行中的最短耗时（毫秒）
+    double runMillis(const std::string& command)
+    {
+        double best = 1e300;
+        for (int i = 0; i < repetitions; ++i) {
+            const auto start = std::chrono::steady_clock::now();
+            if (std::system(command.c_str()) != 0) {
+                std::fprintf(stderr, "command failed: %s\n", command.c_str());
+                std::exit(EXIT_FAILURE);
+            }
+            const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+            best                                                    = std::min(best, elapsed.count());
+        }
+        return best;
+    }
+
+    // 模板实例化和内联函数在目标文件中是弱符号（COMDAT），以其数量近似实例化数量；MSVC 下不统计
+    long long countWeakSymbols([[maybe_unused]] const std::filesystem::path& object, [[maybe_unused]] const std::filesystem::path& listing)
+    {
+#ifdef _MSC_VER
+        return -1;
+#else
+        const std::string command = "nm --defined-only " + quoted(object) + " > " + quoted(listing);
+        if (std::system(command.c_str()) != 0) {
+            return -1;
+        }
+        std::ifstream in(listing);
+        long long count = 0;
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.find(" W ") != std::string::npos || line.find(" V ") != std::string::npos) {
+                ++count;
+            }
+        }
+        return count;
+#endif
+    }
+
+    Result measure(const std::filesystem::path& dir, Backend backend, int structs, int members)
+    {
+        const auto stem   = std::string(backendName(backend)) + "_" + std::to_string(structs) + "x" + std::to_string(members);
+        const auto source = dir / (stem + ".cpp");
+        const auto object = dir / (stem + ".o");
+        {
+            std::ofstream out(source, std::ios::trunc);
+            out << generateSource(backend, structs, members);
+        }
+#ifdef _MSC_VER
+        const std::string base     = std::string("\"") + RYREFLECT_BENCH_CXX + "\" /nologo /std:c++latest /Zc:preprocessor /EHsc " + RYREFLECT_BENCH_FLAGS + " ";
+        const std::string frontend = base + "/Zs " + quoted(source);
+        const std::string compile  = base + "/O2 /c " + quoted(source) + " /Fo" + quoted(object) + " > NUL";
+#else
+        const std::string base     = std::string("\"") + RYREFLECT_BENCH_CXX + "\" -std=c++23 " + RYREFLECT_BENCH_FLAGS + " ";
+        const std::string frontend = base + "-fsyntax-only " + quoted(source);
+        const std::string compile  = base + "-O2 -c " + quoted(source) + " -o " + quoted(object);
+#endif
+        Result result;
+        result.backend        = backend;
+        result.structs        = structs;
+        result.members        = members;
+        result.frontendMillis = runMillis(frontend);
+        result.compileMillis  = runMillis(compile);
+        result.objectBytes    = std::filesystem::file_size(object);
+        result.instantiations = countWeakSymbols(object, dir / (stem + ".nm"));
+        return result;
+    }
+
+    std::vector<int> parseList(const char* text)
+    {
+        std::vector<int> values;
+        std::istringstream in(text);
+        std::string item;
+        while (std::getline(in, item, ',')) {
+            values.push_back(std::atoi(item.c_str()));
+        }
+        return values;
+    }
+
+    Options parseOptions(int argc, char* argv[])
+    {
+        Options options;
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--json") {
+                options.json = true;
+            }
+            else if (arg.rfind("--structs=", 0) == 0) {
+                options.structs = parseList(argv[i] + std::strlen("--structs="));
+            }
+            else if (arg.rfind("--members=", 0) == 0) {
+                options.members = parseList(argv[i] + std::strlen("--members="));
+            }
+            else {
+                std::fprintf(stderr, "usage: %s [--json] [--structs=N,...] [--members=M,...]\n", argv[0]);
+                std::exit(EXIT_FAILURE);
+            }
+        }
+        return options;
+    }
+
+    void printResults(const Options& options, const std::vector<Result>& results)
+    {
+        if (options.json) {
+            std::printf("{\"compiler\":\"%s\",\"results\":[", RYREFLECT_BENCH_CXX);
+            for (std::size_t i = 0; i < results.size(); ++i) {
+                const auto& r = results[i];
+                std::printf("%s\n{\"backend\":\"%s\",\"structs\":%d,\"members\":%d,\"frontend_ms\":%.1f,\"compile_ms\":%.1f,\"instantiations\":%lld,\"object_bytes\":%llu}", i ? "," : "",
+                            backendName(r.backend), r.structs, r.members, r.frontendMillis, r.compileMillis, r.instantiations, static_cast<unsigned long long>(r.objectBytes));
+            }
+            std::printf("\n]}\n");
+            return;
+        }
+        std::printf("backend,structs,members,frontend_ms,compile_ms,instantiations,object_bytes\n");
+        for (const auto& r : results) {
+            std::printf("%s,%d,%d,%.1f,%.1f,%lld,%llu\n", backendName(r.backend), r.structs, r.members, r.frontendMillis, r.compileMillis, r.instantiations,
+                        static_cast<unsigned long long>(r.objectBytes));
+        }
+    }
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const auto options = parseOptions(argc, argv);
+    const auto dir     = std::filesystem::temp_directory_path() / "ryreflect_compile_bench";
+    std::filesystem::create_directories(dir);
+
+    std::vector<Result> results;
+    for (const int structs : options.structs) {
+        for (const int members : options.members) {
+            for (const auto backend : {Backend::None, Backend::Json, Backend::Text, Backend::Plan, Backend::Binary}) {
+                results.push_back(measure(dir, backend, structs, members));
+            }
+        }
+    }
+    printResults(options, results);
+    std::filesystem::remove_all(dir);
+    return 0;
+}
@@ -0,0 +1,147 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description 预处理耗时基准：对比 RYREFLECT_FOR_EACH 与旧的生成式宏在 8/32/64/128 个成员下的展开耗时
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef RYREFLECT_BENCH_CXX
+#error "RYREFLECT_BENCH_CXX must name the compiler used for the benchmark"
+#endif
+#ifndef RYREFLECT_BENCH_SOURCE_DIR
+#error "RYREFLECT_BENCH_SOURCE_DIR must point to the directory containing RyReflectForEach.h"
+#endif
+
+namespace
+{
+    // 每个文件重复展开的次数，使宏展开本身的耗时远大于进程启动
+    constexpr int expansionsPerFile = 3000;
+    // 新旧两种宏交替运行的轮数。每一轮都算一次加速比，机器负载的波动对两边的影响相同，取中位数
+    constexpr int rounds = 11;
+
+    std::string memberList(int count)
+    {
+        std::string out;
+        for (int i = 0; i < count; ++i) {
+            out += (i ? ", m_field" : "m_field") + std::to_string(i);
+        }
+        return out;
+    }
+
+    // 复现已移除的 generate.cpp 的输出：RYREFLECT_GET_MACRO 按参数个数选中 RYREFLECT_FOR_EACH_N，
+    // 后者对每个成员再经过一次 RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(...))。上限为 maxCount
+    std::string legacyMacros(int maxCount)
+    {
+        std::ostringstream out;
+        out << "#define RYREFLECT_STRINGIZE(x) #x\n";
+        out << "#define RYREFLECT_EXPAND(x) x\n";
+        out << "#define RYREFLECT_FOR_EACH_1(action, x) action(x)\n";
+        for (int n = 2; n <= maxCount; ++n) {
+            out << "#define RYREFLECT_FOR_EACH_" << n << "(action, x";
+            for (int i = 1; i < n; ++i) {
+                out << ", x" << i;
+            }
+            out << ") action(x)";
+            for (int i = 1; i < n; ++i) {
+                out << ", RYREFLECT_EXPAND(RYREFLECT_FOR_EACH_1(action, x" << i << "))";
+            }
+            out << "\n";
+        }
+        out << "#define RYREFLECT_GET_MACRO(";
+        for (int i = 1; i <= maxCount; ++i) {
+            out << "_" << i << ", ";
+        }
+        out << "NAME, ...) NAME\n";
+        out << "#define RYREFLECT_FOR_EACH(action, ...) RYREFLECT_EXPAND(RYREFLECT_GET_MACRO(__VA_ARGS__";
+        for (int i = maxCount; i >= 1; --i) {
+            out << ", RYREFLECT_FOR_EACH_" << i;
+        }
+        out << ")(action, __VA_ARGS__))\n";
+        return out.str();
+    }
+
+    void writeFile(const std::filesystem::path& path, const std::string& prelude, int members)
+    {
+        std::ofstream out(path, std::ios::trunc);
+        out << prelude;
+        if (members > 0) {
+            const auto list = memberList(members);
+            for (int i = 0; i < expansionsPerFile; ++i) {
+                out << "RYREFLECT_FOR_EACH(RYREFLECT_STRINGIZE, " << list << ")\n";
+            }
+        }
+    }
+
+    // 只运行一次预处理器，返回耗时（毫秒）
+    double preprocessMillis(const std::filesystem::path& path)
+    {
+#ifdef _MSC_VER
+        const std::string command = std::string("\"") + RYREFLECT_BENCH_CXX + "\" /nologo /std:c++latest /Zc:preprocessor /EP \"" + path.string() + "\" > NUL";
+#else
+        const std::string command = std::string("\"") + RYREFLECT_BENCH_CXX + "\" -std=c++20 -E -P \"" + path.string() + "\" -o /dev/null";
+#endif
+        const auto start = std::chrono::steady_clock::now();
+        if (std::system(command.c_str()) != 0) {
+            std::fprintf(stderr, "preprocessing failed: %s\n", command.c_str());
+            std::exit(EXIT_FAILURE);
+        }
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    // 扣除只包含宏定义的文件的耗时，只留下展开本身
+    double expansionMillis(const std::filesystem::path& path, const std::filesystem::path& base)
+    {
+        return std::max(preprocessMillis(path) - preprocessMillis(base), 0.001);
+    }
+
+    double median(std::vector<double> values)
+    {
+        std::sort(values.begin(), values.end());
+        return values[values.size() / 2];
+    }
+} // namespace
+
+int main()
+{
+    const std::vector<int> counts{8, 32, 64, 128};
+    const auto dir = std::filesystem::temp_directory_path() / "ryreflect_preprocess_bench";
+    std::filesystem::create_directories(dir);
+
+    const auto header         = (std::filesystem::path(RYREFLECT_BENCH_SOURCE_DIR) / "RyReflectForEach.h").generic_string();
+    const auto currentPrelude = "#include \"" + header + "\"\n#define RYREFLECT_STRINGIZE(x) #x\n";
+    const auto currentBase    = dir / "current_base.cpp";
+    writeFile(currentBase, currentPrelude, 0);
+
+    std::printf("members,expansions,legacy_ms,current_ms,speedup,speedup_min,speedup_max\n");
+    for (const int n : counts) {
+        // 旧的宏最多支持 64 个成员，超过时按同样的方式生成到 n 个
+        const auto legacyPrelude = legacyMacros(std::max(64, n));
+        const auto legacyBase    = dir / "legacy_base.cpp";
+        const auto currentPath   = dir / ("current_" + std::to_string(n) + ".cpp");
+        const auto legacyPath    = dir / ("legacy_" + std::to_string(n) + ".cpp");
+        writeFile(legacyBase, legacyPrelude, 0);
+        writeFile(currentPath, currentPrelude, n);
+        writeFile(legacyPath, legacyPrelude, n);
+
+        std::vector<double> legacy, current, speedup;
+        for (int round = 0; round < rounds; ++round) {
+            legacy.push_back(expansionMillis(legacyPath, legacyBase));
+            current.push_back(expansionMillis(currentPath, currentBase));
+            speedup.push_back(legacy.back() / current.back());
+        }
+        const auto [low, high] = std::minmax_element(speedup.begin(), speedup.end());
+        std::printf("%d,%d,%.2f,%.2f,%.2f,%.2f,%.2f\n", n, expansionsPerFile, median(legacy), median(current), median(speedup), *low, *high);
+    }
+    std::filesystem::remove_all(dir);
+    return 0;
+}
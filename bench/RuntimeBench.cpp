@@ -0,0 +1,329 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description 运行时基准：测量 toJson、fromJson、toJsonArray、fromJsonArray 以及直接读写文本的内联与表驱动两种实现在几类合成数据上的 ns/op、MB/s 和每次操作的内存分配次数
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#include "../RyReflect.h"
+#include "../RyReflectPlan.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <string>
+#include <vector>
+
+// 替换全局 operator new 统计分配次数，带对齐参数的版本不计入
+namespace
+{
+    std::atomic<std::uint64_t> g_allocations{0};
+}
+
+void* operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace
+{
+    // 扁平结构体：常见的小消息
+    struct Flat
+    {
+        std::int64_t m_id = 0;
+        double m_price    = 0;
+        std::string m_symbol;
+        bool m_active  = false;
+        int m_quantity = 0;
+        std::string m_venue;
+        double m_timestamp = 0;
+        std::vector<int> m_tags;
+
+        RY_REFLECTABLE(Flat, m_id, m_price, m_symbol, m_active, m_quantity, m_venue, m_timestamp, m_tags)
+    };
+
+    struct Leaf
+    {
+        int m_id       = 0;
+        double m_value = 0;
+        std::string m_tag;
+
+        RY_REFLECTABLE(Leaf, m_id, m_value, m_tag)
+    };
+
+    // 深层嵌套：每层一个子对象
+    template <typename Child>
+    struct Nested
+    {
+        int m_depth = 0;
+        std::string m_name;
+        Child m_child;
+
+        RY_REFLECTABLE(Nested, m_depth, m_name, m_child)
+    };
+
+    using Deep = Nested<Nested<Nested<Nested<Nested<Nested<Nested<Nested<Leaf>>>>>>>>;
+
+    // 64 个成员的宽结构体
+    struct Wide
+    {
+        int m_f0 = 0; double m_f1 = 1.5; std::string m_f2 = "field2"; bool m_f3 = true;
+        int m_f4 = 4; double m_f5 = 5.5; std::string m_f6 = "field6"; bool m_f7 = false;
+        int m_f8 = 8; double m_f9 = 9.5; std::string m_f10 = "field10"; bool m_f11 = true;
+        int m_f12 = 12; double m_f13 = 13.5; std::string m_f14 = "field14"; bool m_f15 = false;
+        int m_f16 = 16; double m_f17 = 17.5; std::string m_f18 = "field18"; bool m_f19 = true;
+        int m_f20 = 20; double m_f21 = 21.5; std::string m_f22 = "field22"; bool m_f23 = false;
+        int m_f24 = 24; double m_f25 = 25.5; std::string m_f26 = "field26"; bool m_f27 = true;
+        int m_f28 = 28; double m_f29 = 29.5; std::string m_f30 = "field30"; bool m_f31 = false;
+        int m_f32 = 32; double m_f33 = 33.5; std::string m_f34 = "field34"; bool m_f35 = true;
+        int m_f36 = 36; double m_f37 = 37.5; std::string m_f38 = "field38"; bool m_f39 = false;
+        int m_f40 = 40; double m_f41 = 41.5; std::string m_f42 = "field42"; bool m_f43 = true;
+        int m_f44 = 44; double m_f45 = 45.5; std::string m_f46 = "field46"; bool m_f47 = false;
+        int m_f48 = 48; double m_f49 = 49.5; std::string m_f50 = "field50"; bool m_f51 = true;
+        int m_f52 = 52; double m_f53 = 53.5; std::string m_f54 = "field54"; bool m_f55 = false;
+        int m_f56 = 56; double m_f57 = 57.5; std::string m_f58 = "field58"; bool m_f59 = true;
+        int m_f60 = 60; double m_f61 = 61.5; std::string m_f62 = "field62"; bool m_f63 = false;
+
+        RY_REFLECTABLE(Wide, m_f0, m_f1, m_f2, m_f3, m_f4, m_f5, m_f6, m_f7, m_f8, m_f9, m_f10, m_f11, m_f12, m_f13, m_f14, m_f15, m_f16, m_f17, m_f18, m_f19,
+                       m_f20, m_f21, m_f22, m_f23, m_f24, m_f25, m_f26, m_f27, m_f28, m_f29, m_f30, m_f31, m_f32, m_f33, m_f34, m_f35, m_f36, m_f37, m_f38,
+                       m_f39, m_f40, m_f41, m_f42, m_f43, m_f44, m_f45, m_f46, m_f47, m_f48, m_f49, m_f50, m_f51, m_f52, m_f53, m_f54, m_f55, m_f56, m_f57,
+                       m_f58, m_f59, m_f60, m_f61, m_f62, m_f63)
+    };
+
+    Flat makeFlat(int i)
+    {
+        Flat flat;
+        flat.m_id        = 1'000'000 + i;
+        flat.m_price     = 100.25 + i * 0.01;
+        flat.m_symbol    = "SYM" + std::to_string(i % 500);
+        flat.m_active    = i % 3 != 0;
+        flat.m_quantity  = i % 1000;
+        flat.m_venue     = i % 2 ? "XNAS" : "XNYS";
+        flat.m_timestamp = 1.7e9 + i;
+        flat.m_tags      = {i % 7, i % 11, i % 13};
+        return flat;
+    }
+
+    template <typename T>
+    void fillNested(T& node, int depth)
+    {
+        if constexpr (requires { node.m_child; }) {
+            node.m_depth = depth;
+            node.m_name  = "level" + std::to_string(depth);
+            fillNested(node.m_child, depth + 1);
+        }
+        else {
+            node.m_id    = depth;
+            node.m_value = depth * 1.5;
+            node.m_tag   = "leaf";
+        }
+    }
+
+    struct Options
+    {
+        bool json      = false;
+        double minTime = 0.2;
+        std::string filter;
+    };
+
+    struct Result
+    {
+        std::string name;
+        std::string dataset;
+        std::uint64_t iterations = 0;
+        double nsPerOp           = 0;
+        double mbPerSec          = 0;
+        double allocsPerOp       = 0;
+        std::size_t bytesPerOp   = 0;
+    };
+
+    // 防止被测结果被优化掉
+    std::size_t g_sink = 0;
+
+    // 倍增迭代次数直到单批耗时达到 minTime，报告最后一批；bytesPerOp 为一次操作对应的 JSON 文本长度
+    Result measure(const Options& options, const char* name, const char* dataset, std::size_t bytesPerOp, const std::function<std::size_t()>& op)
+    {
+        using Clock = std::chrono::steady_clock;
+        g_sink += op();
+        std::uint64_t iterations = 1;
+        for (;;) {
+            const auto allocationsBefore = g_allocations.load(std::memory_order_relaxed);
+            const auto start             = Clock::now();
+            for (std::uint64_t i = 0; i < iterations; ++i) {
+                g_sink += op();
+            }
+            const std::chrono::duration<double> elapsed = Clock::now() - start;
+            const auto allocations                      = g_allocations.load(std::memory_order_relaxed) - allocationsBefore;
+            if (elapsed.count() >= options.minTime || iterations >= (std::uint64_t{1} << 40)) {
+                Result result;
+                result.name        = name;
+                result.dataset     = dataset;
+                result.iterations  = iterations;
+                result.nsPerOp     = elapsed.count() * 1e9 / static_cast<double>(iterations);
+                result.mbPerSec    = static_cast<double>(bytesPerOp) * static_cast<double>(iterations) / elapsed.count() / 1e6;
+                result.allocsPerOp = static_cast<double>(allocations) / static_cast<double>(iterations);
+                result.bytesPerOp  = bytesPerOp;
+                return result;
+            }
+            iterations *= 2;
+        }
+    }
+
+    // 直接读写文本：toJsonString/fromJsonInto 为每个成员内联展开，*ByPlan 版本由共用的解释循环按表执行
+    template <typename T>
+    void benchText(const Options& options, std::vector<Result>& results, const char* dataset, const T& value)
+    {
+        const auto text = RyReflect::toJsonString(value);
+        std::string out;
+        T decoded = value;
+        results.push_back(measure(options, "toJsonString", dataset, text.size(), [&] {
+            RyReflect::toJsonString(value, out);
+            return out.size();
+        }));
+        results.push_back(measure(options, "toJsonStringByPlan", dataset, text.size(), [&] {
+            RyReflect::toJsonStringByPlan(value, out);
+            return out.size();
+        }));
+        results.push_back(measure(options, "fromJsonInto", dataset, text.size(), [&] {
+            RyReflect::fromJsonInto(decoded, text);
+            return sizeof(decoded);
+        }));
+        results.push_back(measure(options, "fromJsonIntoByPlan", dataset, text.size(), [&] {
+            RyReflect::fromJsonIntoByPlan(decoded, text);
+            return sizeof(decoded);
+        }));
+    }
+
+    template <typename T>
+    void benchObject(const Options& options, std::vector<Result>& results, const char* dataset, const T& value)
+    {
+        const auto bytes = RyReflect::toJsonString(value).size();
+        const auto json  = value.toJson();
+        results.push_back(measure(options, "toJson", dataset, bytes, [&] { return static_cast<std::size_t>(value.toJson().size()); }));
+        results.push_back(measure(options, "fromJson", dataset, bytes, [&] {
+            const T decoded = T::fromJson(json);
+            return static_cast<std::size_t>(sizeof(decoded));
+        }));
+        benchText(options, results, dataset, value);
+    }
+
+    template <typename T>
+    void benchArray(const Options& options, std::vector<Result>& results, const char* dataset, const std::vector<T>& values)
+    {
+        const auto bytes = RyReflect::toJsonString(values).size();
+        const auto array = RyReflect::toJsonArray(values);
+        results.push_back(measure(options, "toJsonArray", dataset, bytes, [&] { return static_cast<std::size_t>(RyReflect::toJsonArray(values).size()); }));
+        results.push_back(measure(options, "fromJsonArray", dataset, bytes, [&] { return RyReflect::fromJsonArray<std::vector<T>>(array).size(); }));
+        benchText(options, results, dataset, values);
+    }
+
+    void printResults(const Options& options, const std::vector<Result>& results)
+    {
+#ifdef RY_USE_QT
+        const char* backend = "qt";
+#else
+        const char* backend = "std";
+#endif
+        if (options.json) {
+            std::printf("{\"backend\":\"%s\",\"results\":[", backend);
+            for (std::size_t i = 0; i < results.size(); ++i) {
+                const auto& r = results[i];
+                std::printf("%s\n{\"name\":\"%s\",\"dataset\":\"%s\",\"iterations\":%llu,\"ns_per_op\":%.2f,\"mb_per_s\":%.2f,\"allocs_per_op\":%.2f,\"bytes_per_op\":%zu}",
+                            i ? "," : "", r.name.c_str(), r.dataset.c_str(), static_cast<unsigned long long>(r.iterations), r.nsPerOp, r.mbPerSec, r.allocsPerOp, r.bytesPerOp);
+            }
+            std::printf("\n]}\n");
+            return;
+        }
+        std::printf("backend,name,dataset,iterations,ns_per_op,mb_per_s,allocs_per_op,bytes_per_op\n");
+        for (const auto& r : results) {
+            std::printf("%s,%s,%s,%llu,%.2f,%.2f,%.2f,%zu\n", backend, r.name.c_str(), r.dataset.c_str(), static_cast<unsigned long long>(r.iterations), r.nsPerOp, r.mbPerSec,
+                        r.allocsPerOp, r.bytesPerOp);
+        }
+    }
+
+    Options parseOptions(int argc, char* argv[])
+    {
+        Options options;
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--json") {
+                options.json = true;
+            }
+            else if (arg.rfind("--min-time=", 0) == 0) {
+                options.minTime = std::atof(arg.c_str() + std::strlen("--min-time="));
+            }
+            else if (arg.rfind("--filter=", 0) == 0) {
+                options.filter = arg.substr(std::strlen("--filter="));
+            }
+            else {
+                std::fprintf(stderr, "usage: %s [--json] [--min-time=seconds] [--filter=dataset]\n", argv[0]);
+                std::exit(EXIT_FAILURE);
+            }
+        }
+        return options;
+    }
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const auto options = parseOptions(argc, argv);
+    const auto enabled = [&](const char* dataset) { return options.filter.empty() || std::string(dataset).find(options.filter) != std::string::npos; };
+
+    std::vector<Result> results;
+    if (enabled("flat")) {
+        benchObject(options, results, "flat", makeFlat(42));
+    }
+    if (enabled("deep")) {
+        Deep deep;
+        fillNested(deep, 0);
+        benchObject(options, results, "deep", deep);
+    }
+    if (enabled("wide")) {
+        benchObject(options, results, "wide", Wide{});
+    }
+    if (enabled("flat_vector")) {
+        std::vector<Flat> flats;
+        flats.reserve(100'000);
+        for (int i = 0; i < 100'000; ++i) {
+            flats.push_back(makeFlat(i));
+        }
+        benchArray(options, results, "flat_vector_100k", flats);
+    }
+    if (enabled("wide_vector")) {
+        benchArray(options, results, "wide_vector_1k", std::vector<Wide>(1'000));
+    }
+    printResults(options, results);
+    return g_sink == 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
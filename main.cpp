@@ -6,8 +6,12 @@
 #include "RyReflect.h"
 #include <string>
 #include <iostream>
-#include <QJsonDocument>
+#include <list>
 #include <set>
+#ifdef RY_USE_QT
+#include <QJsonDocument>
+#include <QVector>
+#endif
 
 void testForEach()
 {
@@ -53,7 +57,11 @@ void testJson()
         std::string teamName;
         std::vector<Person> memberVector;
         std::list<Person> memberList;
+#ifdef RY_USE_QT
         QVector<std::string> memberNames;
+#else
+        std::vector<std::string> memberNames;
+#endif
 
         RY_REFLECTABLE(Team, teamName, memberVector, memberList, memberNames)
     };
@@ -62,7 +70,11 @@ void testJson()
     Person person2{ "Bob", 25 };
     std::vector personVector{ person1, person2 };
     std::list personList{ person1, person2 };
+#ifdef RY_USE_QT
     QVector<std::string> nameSet{ "Alice", "Bob" };
+#else
+    std::vector<std::string> nameSet{ "Alice", "Bob" };
+#endif
 
     Team team{ "Developers", personVector, personList, nameSet };
 
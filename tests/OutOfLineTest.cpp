@@ -0,0 +1,60 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description RY_REFLECT_OUT_OF_LINE 模式的往返测试：本翻译单元只看到声明，toJson/fromJson 链接到 OutOfLineTypes.cpp 中的定义
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#include "OutOfLineTypes.h"
+#include <cstdio>
+
+#ifndef RY_REFLECT_OUT_OF_LINE
+#error "OutOfLineTest must be built with RY_REFLECT_OUT_OF_LINE"
+#endif
+
+namespace
+{
+    int failures = 0;
+
+#define CHECK(expr)                                                                       \
+    do {                                                                                  \
+        if (!(expr)) {                                                                    \
+            ++failures;                                                                   \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+        }                                                                                 \
+    } while (false)
+
+    shop::Order sampleOrder()
+    {
+        shop::Order order;
+        order.id      = 42;
+        order.address = { "Springfield", 12345 };
+        order.items   = { { "apple", 0.5 }, { "pear", 1.25 } };
+        order.tags    = { 1, -2, 3 };
+        return order;
+    }
+} // namespace
+
+int main()
+{
+    const shop::Order order = sampleOrder();
+    const auto        text  = RyReflect::toJsonString(order);
+
+    // 成员函数、嵌套类型和 std::vector<Item> 都经过另一个翻译单元中显式实例化的函数
+    const shop::Order decoded = shop::Order::fromJson(order.toJson());
+    CHECK(RyReflect::toJsonString(decoded) == text);
+    CHECK(decoded.items.size() == 2 && decoded.items[1].name == "pear" && decoded.address.zip == 12345);
+
+    const auto items = RyReflect::fromJsonArray<std::vector<shop::Item>>(RyReflect::toJsonArray(order.items));
+    CHECK(RyReflect::toJsonString(items) == RyReflect::toJsonString(order.items));
+    CHECK(RyReflect::toJsonString(RyReflect::fromJsonValue<shop::Address>(RyReflect::toJsonValue(order.address))) == RyReflect::toJsonString(order.address));
+
+    // 文本接口不经过 toJson/fromJson，两种模式下行为相同
+    CHECK(RyReflect::toJsonString(RyReflect::fromJsonString<shop::Order>(text)) == text);
+
+    if (failures != 0) {
+        std::fprintf(stderr, "%d check(s) failed\n", failures);
+        return 1;
+    }
+    std::printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,11 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description 在单个翻译单元中定义并实例化 OutOfLineTypes.h 中各类型的编解码代码
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#include "OutOfLineTypes.h"
+
+RY_REFLECT_IMPL(shop::Address)
+RY_REFLECT_IMPL(shop::Item)
+RY_REFLECT_IMPL(shop::Order)
@@ -0,0 +1,43 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description RY_REFLECT_OUT_OF_LINE 模式的测试类型，toJson/fromJson 只在 OutOfLineTypes.cpp 中定义
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#pragma once
+#include "../RyReflect.h"
+#include <string>
+#include <vector>
+
+namespace shop
+{
+    struct Address
+    {
+        std::string city;
+        int         zip = 0;
+
+        RY_REFLECTABLE(Address, city, zip)
+    };
+
+    struct Item
+    {
+        std::string name;
+        double      price = 0;
+
+        RY_REFLECTABLE(Item, name, price)
+    };
+
+    struct Order
+    {
+        std::int64_t      id = 0;
+        Address           address;
+        std::vector<Item> items;
+        std::vector<int>  tags;
+
+        RY_REFLECTABLE(Order, id, address, items, tags)
+    };
+} // namespace shop
+
+RY_REFLECT_DECLARE(shop::Address)
+RY_REFLECT_DECLARE(shop::Item)
+RY_REFLECT_DECLARE(shop::Order)
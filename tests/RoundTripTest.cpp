@@ -0,0 +1,438 @@
+﻿/**
+ * @author rayzhang
+ * @date 2026年10月17日
+ * @description 往返测试：每个头文件的编码、解码路径都与 toJsonString/fromJsonString 的结果对照
+ * @github https://github.com/ZZray/RyReflect.git
+ */
+#include "../RyReflect.h"
+#include "../RyReflectBinary.h"
+#include "../RyReflectDiff.h"
+#include "../RyReflectDocument.h"
+#include "../RyReflectIncremental.h"
+#include "../RyReflectLazy.h"
+#include "../RyReflectNdjson.h"
+#include "../RyReflectParallel.h"
+#include "../RyReflectParser.h"
+#include "../RyReflectPlan.h"
+#include "../RyReflectView.h"
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    int failures = 0;
+
+#define CHECK(expr)                                                               \
+    do {                                                                          \
+        if (!(expr)) {                                                            \
+            ++failures;                                                           \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); \
+        }                                                                         \
+    } while (false)
+
+    // 期望 fn 抛出 E，返回异常信息，没有抛出时记为失败
+    template <typename E, typename F>
+    std::string expectThrow(F&& fn, int line)
+    {
+        try {
+            fn();
+        }
+        catch (const E& error) {
+            return error.what();
+        }
+        ++failures;
+        std::fprintf(stderr, "%s:%d: expected exception not thrown\n", __FILE__, line);
+        return {};
+    }
+
+    struct Address
+    {
+        std::string street;
+        std::string city;
+
+        RY_REFLECTABLE(Address, street, city)
+    };
+
+    struct Item
+    {
+        std::string name;
+        int         qty   = 0;
+        double      price = 0;
+
+        RY_REFLECTABLE(Item, name, qty, price)
+    };
+
+    struct Order
+    {
+        std::int64_t      id   = 0;
+        std::uint64_t     big  = 0;
+        bool              paid = false;
+        std::string       note;
+        Address           address;
+        std::vector<Item> items;
+        std::vector<int>  tags;
+
+        RY_REFLECTABLE(Order, id, big, paid, note, address, items, tags)
+    };
+
+    struct Node
+    {
+        std::vector<Node> children;
+
+        RY_REFLECTABLE(Node, children)
+    };
+
+    struct Empty
+    {
+        RY_REFLECTABLE(Empty)
+    };
+
+    struct EmptyList
+    {
+        std::vector<Empty> items;
+        int                tail = 0;
+
+        RY_REFLECTABLE(EmptyList, items, tail)
+    };
+
+#ifdef RY_USE_QT
+    struct QtStrings
+    {
+        QString    text;
+        QByteArray bytes;
+
+        RY_REFLECTABLE(QtStrings, text, bytes)
+    };
+#endif
+
+    // 超过 RYREFLECT_FOR_EACH 第一层的宽度，覆盖多层展开
+    // 70 个成员，超过 RYREFLECT_FOR_EACH 的一级和部分解码中按位记录的 64 个子项
+    struct Wide
+    {
+        int m0 = 0; int m1 = 1; int m2 = 2; int m3 = 3; int m4 = 4; int m5 = 5; int m6 = 6; int m7 = 7; int m8 = 8; int m9 = 9;
+        int m10 = 10; int m11 = 11; int m12 = 12; int m13 = 13; int m14 = 14; int m15 = 15; int m16 = 16; int m17 = 17; int m18 = 18; int m19 = 19;
+        int m20 = 20; int m21 = 21; int m22 = 22; int m23 = 23; int m24 = 24; int m25 = 25; int m26 = 26; int m27 = 27; int m28 = 28; int m29 = 29;
+        int m30 = 30; int m31 = 31; int m32 = 32; int m33 = 33; int m34 = 34; int m35 = 35; int m36 = 36; int m37 = 37; int m38 = 38; int m39 = 39;
+        int m40 = 40; int m41 = 41; int m42 = 42; int m43 = 43; int m44 = 44; int m45 = 45; int m46 = 46; int m47 = 47; int m48 = 48; int m49 = 49;
+        int m50 = 50; int m51 = 51; int m52 = 52; int m53 = 53; int m54 = 54; int m55 = 55; int m56 = 56; int m57 = 57; int m58 = 58; int m59 = 59;
+        int m60 = 60; int m61 = 61; int m62 = 62; int m63 = 63; int m64 = 64; int m65 = 65; int m66 = 66; int m67 = 67; int m68 = 68; int m69 = 69;
+
+        RY_REFLECTABLE(Wide, m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60, m61, m62, m63, m64, m65, m66, m67, m68, m69)
+    };
+
+    Order sampleOrder(std::size_t itemCount = 3)
+    {
+        Order order;
+        order.id      = -9007199254740993;
+        order.big     = 18446744073709551615u;
+        order.paid    = true;
+        order.note    = "quote \" backslash \\ newline \n tab \t 中文 \x01";
+        order.address = Address{ "1 Main St", "Springfield" };
+        for (std::size_t i = 0; i < itemCount; ++i) {
+            order.items.push_back(Item{ "item" + std::to_string(i), static_cast<int>(i), 0.25 * static_cast<double>(i) });
+        }
+        order.tags = { 1, -2, 3 };
+        return order;
+    }
+
+    template <typename T>
+    bool same(const T& a, const T& b)
+    {
+        return RyReflect::toJsonString(a) == RyReflect::toJsonString(b);
+    }
+
+    void testText()
+    {
+        const Order order = sampleOrder();
+        const auto  text  = RyReflect::toJsonString(order);
+        CHECK(same(RyReflect::fromJsonString<Order>(text), order));
+        CHECK(same(Order::fromJson(order.toJson()), order));
+        CHECK(RyReflect::toJsonString(RyReflect::fromJsonString<Wide>(RyReflect::toJsonString(Wide{}))) == RyReflect::toJsonString(Wide{}));
+        CHECK(RyReflect::memberCount<Wide> == 70);
+    }
+
+    void testInto()
+    {
+        Order order = sampleOrder();
+        RyReflect::fromJsonInto(order, R"({"items":[{"name":"a"}],"tags":[]})");
+        // 复用的元素不保留上一次的 qty、price
+        CHECK(order.items.size() == 1 && order.items[0].name == "a" && order.items[0].qty == 0 && order.items[0].price == 0);
+        CHECK(order.tags.empty() && order.id == sampleOrder().id);
+
+        RyReflect::fromJsonInto(order, sampleOrder().toJson());
+        CHECK(same(order, sampleOrder()));
+    }
+
+    void testErrors()
+    {
+        expectThrow<RyReflect::JsonParseError>([] { RyReflect::fromJsonString<Item>(R"({"qty":01})"); }, __LINE__);
+        expectThrow<RyReflect::JsonParseError>([] { RyReflect::fromJsonString<Item>(R"({"qty":-})"); }, __LINE__);
+        expectThrow<RyReflect::JsonParseError>([] { RyReflect::fromJsonString<Item>(R"({"other":1.e5,"qty":1})"); }, __LINE__);
+
+        std::string deep;
+        for (int i = 0; i < 5000; ++i) {
+            deep += R"({"children":[)";
+        }
+        const auto tooDeep = RyReflect::tryFromJson<Node>(deep);
+        CHECK(!tooDeep && tooDeep.error().code == RyReflect::JsonErrorCode::TooDeep);
+
+        const auto mismatch = RyReflect::tryFromJson<Order>(R"({"items":[{"qty":"x"}]})");
+        CHECK(!mismatch && mismatch.error().code == RyReflect::JsonErrorCode::TypeMismatch && mismatch.error().path == "$.items[0].qty");
+        const auto range = RyReflect::tryFromJson<Item>(R"({"qty":1e20})");
+        CHECK(!range && range.error().code == RyReflect::JsonErrorCode::OutOfRange);
+        const auto truncated = RyReflect::tryFromJson<Item>(R"({"name":"abc)");
+        CHECK(!truncated && truncated.error().code == RyReflect::JsonErrorCode::UnexpectedEnd);
+    }
+
+    void testBinary()
+    {
+        const Order order = sampleOrder();
+        CHECK(same(RyReflect::fromBinary<Order>(RyReflect::toBinary(order)), order));
+
+        EmptyList list;
+        list.items.resize(3);
+        list.tail          = 7;
+        const auto decoded = RyReflect::fromBinary<EmptyList>(RyReflect::toBinary(list));
+        CHECK(decoded.items.size() == 3 && decoded.tail == 7);
+
+        // 每层 Node 是一个元素个数 1，超过嵌套上限时报错而不是耗尽栈空间
+        const RyReflect::BinaryBuffer deep(100000, std::byte{1});
+        expectThrow<RyReflect::BinaryDecodeError>([&] { RyReflect::fromBinary<Node>(deep); }, __LINE__);
+        // 零字节元素的个数不受输入长度限制，伪造的巨大个数直接报错
+        const RyReflect::BinaryBuffer forged{std::byte{0xff}, std::byte{0xff}, std::byte{0xff}, std::byte{0xff}, std::byte{0x0f}, std::byte{0}};
+        const auto error = expectThrow<RyReflect::BinaryDecodeError>([&] { RyReflect::fromBinary<EmptyList>(forged); }, __LINE__);
+        CHECK(error.find("too many empty elements") != std::string::npos);
+    }
+
+    void testView()
+    {
+        const Order order = sampleOrder();
+        const auto  bytes = RyReflect::toViewBuffer(order);
+        const RyReflect::View<Order> view(bytes);
+        CHECK(view.get<"id">() == order.id);
+        CHECK(view.get<"address">().get<"city">() == "Springfield");
+        CHECK(same(view.load(), order));
+
+        // 长度和个数超出 uint32 时报错而不是截断（无法在测试中构造 4 GiB 的字符串，直接调用写长度的函数）
+        if constexpr (sizeof(std::size_t) > sizeof(std::uint32_t)) {
+            RyReflect::BinaryBuffer out;
+            CHECK(expectThrow<std::length_error>([&] { RyReflect::writeViewLength(out, std::size_t{std::numeric_limits<std::uint32_t>::max()} + 1); }, __LINE__) == "RyReflect: view length exceeds 4 GiB");
+            CHECK(out.empty());
+        }
+    }
+
+    void testParser()
+    {
+        const Order order = sampleOrder();
+        CHECK(same(Order::fromJson(RyReflect::parseJsonObject(RyReflect::toJsonString(order))), order));
+    }
+
+    void testDocument()
+    {
+        const Order order = sampleOrder();
+        const auto  text  = RyReflect::toJsonString(order);
+        RyReflect::Document doc;
+        doc.root() = RyReflect::toJson(order, doc);
+        CHECK(RyReflect::toJsonString(doc.root()) == text);
+        doc.parse(text);
+        CHECK(same(RyReflect::fromJson<Order>(doc.root()), order));
+    }
+
+    void testParallel()
+    {
+        const Order order = sampleOrder(5000);
+        const auto  text  = RyReflect::toJsonString(order);
+        CHECK(RyReflect::toJsonStringParallel(order) == text);
+        CHECK(same(RyReflect::fromJsonStringParallel<Order>(text), order));
+
+        // 字符串成员即使长度超过 minElements 也按字符串写出
+        RyReflect::ParallelOptions options;
+        options.minElements = 16;
+        Order longNote      = sampleOrder(100);
+        longNote.note.append(5000, 'a');
+        const auto longText = RyReflect::toJsonString(longNote);
+        CHECK(RyReflect::toJsonStringParallel(longNote, options) == longText);
+        CHECK(same(RyReflect::fromJsonStringParallel<Order>(longText, options), longNote));
+    }
+
+    void testNdjson()
+    {
+        std::stringstream stream;
+        {
+            RyReflect::NdjsonWriter<Order> writer(stream);
+            writer.write(sampleOrder(1));
+            writer.write(sampleOrder(2));
+            writer.flush();
+        }
+        RyReflect::NdjsonReader<Order> reader(stream);
+        Order order;
+        CHECK(reader.read(order) && same(order, sampleOrder(1)));
+        CHECK(reader.read(order) && same(order, sampleOrder(2)));
+        CHECK(!reader.read(order));
+
+        // 超长的行被跳过，之后的行照常解码；并行模式下按顺序在该行的位置报告
+        for (const bool parallel : { false, true }) {
+            std::stringstream input(std::string(1000, 'x') + "\n" + RyReflect::toJsonString(sampleOrder(0)) + "\n" + std::string(100, 'y'));
+            RyReflect::NdjsonOptions options;
+            options.bufferSize  = 16;
+            options.maxLineSize = 256;
+            options.parallel    = parallel;
+            RyReflect::NdjsonReader<Order> limited(input, options);
+            const auto error = expectThrow<RyReflect::NdjsonParseError>([&] { limited.read(order); }, __LINE__);
+            CHECK(error.find("line too long") != std::string::npos);
+            CHECK(limited.read(order) && same(order, sampleOrder(0)) && limited.lineNumber() == 2);
+            expectThrow<RyReflect::NdjsonParseError>([&] { limited.read(order); }, __LINE__);
+            CHECK(!limited.read(order));
+        }
+
+        // 恰好 maxLineSize 字节的行可以读取，换行符不计入上限；多一个字节即超长
+        for (const bool parallel : { false, true }) {
+            const auto        line = RyReflect::toJsonString(sampleOrder(0));
+            std::stringstream input(line + "\n" + line + " \n" + line);
+            RyReflect::NdjsonOptions options;
+            options.bufferSize  = 16;
+            options.maxLineSize = line.size();
+            options.parallel    = parallel;
+            RyReflect::NdjsonReader<Order> exact(input, options);
+            CHECK(exact.read(order) && same(order, sampleOrder(0)));
+            CHECK(expectThrow<RyReflect::NdjsonParseError>([&] { exact.read(order); }, __LINE__).find("line too long") != std::string::npos);
+            CHECK(exact.read(order) && same(order, sampleOrder(0)) && exact.lineNumber() == 3);
+            CHECK(!exact.read(order));
+        }
+    }
+
+    void testIncremental()
+    {
+        const Order order = sampleOrder();
+        const auto  text  = RyReflect::toJsonString(order);
+        RyReflect::IncrementalDecoder<Order> decoder;
+        // 逐字节送入，每个记号都会跨越分段边界
+        for (std::size_t i = 0; i < text.size(); ++i) {
+            decoder.feed(std::string_view(text).substr(i, 1));
+        }
+        CHECK(decoder.ready());
+        CHECK(same(decoder.take(), order));
+    }
+
+    void testFields()
+    {
+        const Order order   = sampleOrder();
+        const auto  decoded = RyReflect::fromJsonString<Order>(RyReflect::toJsonString(order), RyReflect::fields<"id", "items.price">);
+        CHECK(decoded.id == order.id && decoded.note.empty() && decoded.items.size() == order.items.size());
+        CHECK(decoded.items[2].price == order.items[2].price && decoded.items[2].name.empty());
+
+        // 选择超过 64 个成员时每个成员都要读到
+        Wide wide;
+        RyReflect::forEach(wide, [](const char*, int& value) { value += 100; });
+        RyReflect::FieldMask all;
+        for (int i = 0; i < 70; ++i) {
+            all.add("m" + std::to_string(i));
+        }
+        CHECK(same(RyReflect::fromJsonString<Wide>(RyReflect::toJsonString(wide), all), wide));
+
+        // 编译期路径用 static_assert 检查，运行时路径不是成员时抛出异常
+        static_assert(RyReflect::isFieldPath<Order>("items.price") && RyReflect::isFieldPath<Node>("children.children"));
+        static_assert(!RyReflect::isFieldPath<Order>("tss") && !RyReflect::isFieldPath<Order>("id.x"));
+        const auto text = RyReflect::toJsonString(order);
+        CHECK(expectThrow<std::invalid_argument>([&] { RyReflect::fromJsonString<Order>(text, RyReflect::FieldMask{"id", "tss"}); }, __LINE__).find("\"tss\"") != std::string::npos);
+        CHECK(expectThrow<std::invalid_argument>([&] { RyReflect::fromJsonString<Order>(text, RyReflect::FieldMask{"address.town"}); }, __LINE__).find("\"address.town\"") != std::string::npos);
+
+        // 重复的键只取第一次出现的值，无论是否已经读完所有选择的成员
+        CHECK(RyReflect::fromJsonString<Order>(R"({"id":1,"id":2})", RyReflect::fields<"id">).id == 1);
+        const auto duplicated = RyReflect::fromJsonString<Order>(R"({"id":1,"id":2,"note":"n"})", RyReflect::fields<"id", "note">);
+        CHECK(duplicated.id == 1 && duplicated.note == "n");
+    }
+
+    void testLazy()
+    {
+        const Order order = sampleOrder();
+        const auto  text  = RyReflect::toJsonString(order);
+        RyReflect::Lazy<Order> lazy(text);
+        CHECK(lazy.get<"id">() == order.id);
+        CHECK(RyReflect::toJsonString(lazy) == text);
+        lazy.edit<"note">() = "edited";
+        Order expected = order;
+        expected.note  = "edited";
+        CHECK(RyReflect::toJsonString(lazy) == RyReflect::toJsonString(expected));
+    }
+
+    void testPlan()
+    {
+        const Order order = sampleOrder();
+        const auto  text  = RyReflect::toJsonString(order);
+        CHECK(RyReflect::toJsonStringByPlan(order) == text);
+        CHECK(same(RyReflect::fromJsonStringByPlan<Order>(text), order));
+        CHECK(RyReflect::toJsonStringByPlan(Wide{}) == RyReflect::toJsonString(Wide{}));
+
+        // 错误信息和嵌套层数限制与内联版本一致
+        std::string deep;
+        for (int i = 0; i < 5000; ++i) {
+            deep += R"({"children":[)";
+        }
+        const auto inlined = expectThrow<RyReflect::JsonParseError>([&] { RyReflect::fromJsonString<Node>(deep); }, __LINE__);
+        const auto planned = expectThrow<RyReflect::JsonParseError>([&] { RyReflect::fromJsonStringByPlan<Node>(deep); }, __LINE__);
+        CHECK(inlined == planned && planned.find("document too deep") != std::string::npos);
+#ifdef RY_USE_QT
+        const QtStrings strings{ QStringLiteral("qt \"string\" 中文"), QByteArray("bytes") };
+        CHECK(RyReflect::toJsonStringByPlan(strings) == RyReflect::toJsonString(strings));
+        CHECK(same(RyReflect::fromJsonStringByPlan<QtStrings>(RyReflect::toJsonString(strings)), strings));
+#endif
+    }
+
+    void testDiff()
+    {
+        const Order from = sampleOrder();
+        Order       to   = from;
+        std::string unchanged;
+        CHECK(RyReflect::diff(from, to).empty());
+        CHECK(!RyReflect::diffJsonString(from, to, unchanged) && unchanged == "{}");
+        to.address.city  = "Shelbyville";
+        to.items[1].qty  = 42;
+        to.tags.push_back(4);
+        CHECK(RyReflect::diffJsonString(from, to) == R"({"address":{"city":"Shelbyville"},"items":[{"name":"item0","qty":0,"price":0},{"name":"item1","qty":42,"price":0.25},{"name":"item2","qty":2,"price":0.5}],"tags":[1,-2,3,4]})");
+
+        Order patched = from;
+        RyReflect::applyPatch(patched, RyReflect::diff(from, to));
+        CHECK(same(patched, to));
+        patched = from;
+        RyReflect::applyPatch(patched, RyReflect::diffJsonString(from, to));
+        CHECK(same(patched, to));
+        patched = from;
+        RyReflect::applyPatch(patched, RyReflect::diffBinary(from, to));
+        CHECK(same(patched, to));
+
+        // 二进制增量经过 readBinary，同样受嵌套层数和零字节元素个数的限制；成员标签 1 之后是完整的 children
+        Node tree;
+        const RyReflect::BinaryBuffer deep(100000, std::byte{1});
+        expectThrow<RyReflect::BinaryDecodeError>([&] { RyReflect::applyPatch(tree, std::span<const std::byte>(deep)); }, __LINE__);
+        EmptyList list;
+        const RyReflect::BinaryBuffer forged{std::byte{1}, std::byte{0xff}, std::byte{0xff}, std::byte{0xff}, std::byte{0xff}, std::byte{0x0f}, std::byte{0}};
+        expectThrow<RyReflect::BinaryDecodeError>([&] { RyReflect::applyPatch(list, std::span<const std::byte>(forged)); }, __LINE__);
+    }
+} // namespace
+
+int main()
+{
+    testText();
+    testInto();
+    testErrors();
+    testBinary();
+    testView();
+    testParser();
+    testDocument();
+    testParallel();
+    testNdjson();
+    testIncremental();
+    testFields();
+    testLazy();
+    testPlan();
+    testDiff();
+    if (failures != 0) {
+        std::fprintf(stderr, "%d check(s) failed\n", failures);
+        return 1;
+    }
+    std::printf("all checks passed\n");
+    return 0;
+}